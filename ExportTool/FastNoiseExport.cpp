@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <FastNoise/FastNoise.h>
+
+// Command line front end for FastNoise::ExportGrid
+// Re-running an interrupted export with the same arguments resumes it
+
+static void PrintUsage()
+{
+    printf(
+        "Usage: FastNoiseExport <encoded node tree> <output file> [options]\n"
+        "  -size x y [z]       grid size in samples, 3 values for a 3D volume\n"
+        "  -start x y [z]      grid start in samples, default 0\n"
+        "  -frequency f        default 0.01\n"
+        "  -seed s             default 1337\n"
+        "  -tile n             tile size in samples, default 256 for 2D and 64 for 3D\n"
+        "  -format f           f32, u8, u16, i16 or f16, default f32\n"
+        "  -range min max      value range mapped to integer formats, default -1 1\n"
+        "  -tilerange          quantise each tile to its own min/max\n"
+        "  -threads n          default hardware thread count\n"
+        "  -restart            discard an existing file instead of resuming it\n" );
+}
+
+static bool ParseFormat( const char* name, FastNoise::OutputFormat::Type& type )
+{
+    static const struct { const char* name; FastNoise::OutputFormat::Type type; } kFormats[] =
+    {
+        { "f32", FastNoise::OutputFormat::Float32 },
+        { "u8",  FastNoise::OutputFormat::UInt8 },
+        { "u16", FastNoise::OutputFormat::UInt16 },
+        { "i16", FastNoise::OutputFormat::Int16 },
+        { "f16", FastNoise::OutputFormat::Half },
+    };
+
+    for( const auto& format : kFormats )
+    {
+        if( strcmp( name, format.name ) == 0 )
+        {
+            type = format.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main( int argc, char** argv )
+{
+    if( argc < 3 )
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    const char* encodedNodeTree = argv[1];
+    const char* outputPath = argv[2];
+
+    FastNoise::GridExportSettings settings;
+    settings.sourceHash = FastNoise::HashEncodedNodeTree( encodedNodeTree );
+    settings.threadCount = (int32_t)std::max( 1u, std::thread::hardware_concurrency() );
+    settings.tileSize = 0;
+
+    // Counts the values following an option, negative numbers are values not options
+    auto countValues = [&]( int i )
+    {
+        int count = 0;
+        while( i + 1 + count < argc )
+        {
+            const char* arg = argv[i + 1 + count];
+
+            if( arg[0] == '-' && !isdigit( (unsigned char)arg[1] ) && arg[1] != '.' )
+            {
+                break;
+            }
+            count++;
+        }
+        return count;
+    };
+
+    for( int i = 3; i < argc; i++ )
+    {
+        const char* option = argv[i];
+        int valueCount = countValues( i );
+
+        if( strcmp( option, "-size" ) == 0 && ( valueCount == 2 || valueCount == 3 ) )
+        {
+            settings.dimensions = valueCount;
+            for( int j = 0; j < valueCount; j++ )
+            {
+                settings.size[j] = atoi( argv[i + 1 + j] );
+            }
+        }
+        else if( strcmp( option, "-start" ) == 0 && valueCount >= 2 && valueCount <= 3 )
+        {
+            for( int j = 0; j < valueCount; j++ )
+            {
+                settings.start[j] = atoi( argv[i + 1 + j] );
+            }
+        }
+        else if( strcmp( option, "-frequency" ) == 0 && valueCount == 1 )
+        {
+            settings.frequency = (float)atof( argv[i + 1] );
+        }
+        else if( strcmp( option, "-seed" ) == 0 && valueCount == 1 )
+        {
+            settings.seed = atoi( argv[i + 1] );
+        }
+        else if( strcmp( option, "-tile" ) == 0 && valueCount == 1 )
+        {
+            settings.tileSize = atoi( argv[i + 1] );
+        }
+        else if( strcmp( option, "-format" ) == 0 && valueCount == 1 && ParseFormat( argv[i + 1], settings.format.type ) )
+        {
+        }
+        else if( strcmp( option, "-range" ) == 0 && valueCount == 2 )
+        {
+            settings.format.rangeMin = (float)atof( argv[i + 1] );
+            settings.format.rangeMax = (float)atof( argv[i + 2] );
+        }
+        else if( strcmp( option, "-tilerange" ) == 0 )
+        {
+            settings.perTileRange = true;
+        }
+        else if( strcmp( option, "-threads" ) == 0 && valueCount == 1 )
+        {
+            settings.threadCount = std::max( 1, atoi( argv[i + 1] ) );
+        }
+        else if( strcmp( option, "-restart" ) == 0 )
+        {
+            settings.resume = false;
+        }
+        else
+        {
+            printf( "Invalid option: %s\n", option );
+            PrintUsage();
+            return 1;
+        }
+
+        i += valueCount;
+    }
+
+    if( settings.tileSize == 0 )
+    {
+        settings.tileSize = settings.dimensions == 3 ? 64 : 256;
+    }
+
+    if( settings.size[0] <= 0 || settings.size[1] <= 0 || ( settings.dimensions == 3 && settings.size[2] <= 0 ) || settings.tileSize <= 0 )
+    {
+        printf( "Grid size must be set and tile size must be positive\n" );
+        return 1;
+    }
+
+    FastNoise::SmartNode<> generator = FastNoise::NewFromEncodedNodeTree( encodedNodeTree );
+
+    if( !generator )
+    {
+        printf( "Invalid encoded node tree\n" );
+        return 1;
+    }
+
+    auto startTime = std::chrono::steady_clock::now();
+
+    FastNoise::GridExportResult result;
+
+    if( !FastNoise::ExportGrid( *generator, outputPath, settings, &result ) )
+    {
+        printf( "Export failed, could not map %s or it was written with different settings, use -restart to overwrite it\n", outputPath );
+        return 1;
+    }
+
+    double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+
+    printf( "Exported %s: %zu tiles generated, %zu tiles resumed, %.2fs\n", outputPath, result.tilesGenerated, result.tilesSkipped, seconds );
+    return 0;
+}
@@ -163,6 +163,14 @@ std::vector<int> FastNoiseNodeEditor::Node::GetNodeIDLinks()
         links.emplace_back( GetNodeID( link.first ) );
     }
 
+    for( auto& hybridList : data->hybridLists )
+    {
+        for( auto& link : hybridList )
+        {
+            links.emplace_back( GetNodeID( link.first ) );
+        }
+    }
+
     assert( links.size() < 16 );
 
     return links;
@@ -176,11 +184,24 @@ void FastNoiseNodeEditor::Node::SetNodeLink( int attributeId, FastNoise::NodeDat
     {
         data->nodes[attributeId] = nodeData;
     }
-    else
+    else if( (attributeId -= (int)data->nodes.size()) < (int)data->hybrids.size() )
     {
-        attributeId -= (int)data->nodes.size();
         data->hybrids[attributeId].first = nodeData;
     }
+    else
+    {
+        attributeId -= (int)data->hybrids.size();
+
+        for( auto& hybridList : data->hybridLists )
+        {
+            if( attributeId < (int)hybridList.size() )
+            {
+                hybridList[attributeId].first = nodeData;
+                return;
+            }
+            attributeId -= (int)hybridList.size();
+        }
+    }
 }
 
 void FastNoiseNodeEditor::Node::AutoPositionChildNodes( ImVec2 nodePos, float verticalSpacing )
@@ -530,7 +551,9 @@ void FastNoiseNodeEditor::DoNodes()
             {
                 if( MatchingMembers( newMetadata->memberVariables, nodeMetadata->memberVariables ) &&
                     MatchingMembers( newMetadata->memberNodes, nodeMetadata->memberNodes ) &&
-                    MatchingMembers( newMetadata->memberHybrids, nodeMetadata->memberHybrids ) )
+                    MatchingMembers( newMetadata->memberHybrids, nodeMetadata->memberHybrids ) &&
+                    MatchingMembers( newMetadata->memberHybridLists, nodeMetadata->memberHybridLists ) &&
+                    MatchingMembers( newMetadata->memberStrings, nodeMetadata->memberStrings ) )
                 {
                     nodeMetadata = newMetadata;                    
                 }
@@ -548,6 +571,13 @@ void FastNoiseNodeEditor::DoNodes()
                     {
                         links.emplace( link.first );
                     }
+                    for( auto& hybridList : node.second.data->hybridLists )
+                    {
+                        for( auto& link : hybridList )
+                        {
+                            links.emplace( link.first );
+                        }
+                    }
 
                     for( auto& link : newData.nodes )
                     {
@@ -561,6 +591,15 @@ void FastNoiseNodeEditor::DoNodes()
                         link.first = links.front();
                         links.pop();
                     }
+                    for( auto& hybridList : newData.hybridLists )
+                    {
+                        for( auto& link : hybridList )
+                        {
+                            if( links.empty() ) break;
+                            link.first = links.front();
+                            links.pop();
+                        }
+                    }
 
                     *node.second.data = std::move( newData );                  
                 }
@@ -615,6 +654,60 @@ void FastNoiseNodeEditor::DoNodes()
             imnodes::EndInputAttribute();
         }
 
+        for( size_t i = 0; i < nodeMetadata->memberHybridLists.size(); i++ )
+        {
+            auto& memberList = nodeMetadata->memberHybridLists[i];
+            auto& hybridList = nodeData->hybridLists[i];
+
+            for( size_t j = 0; j < hybridList.size(); j++ )
+            {
+                imnodes::BeginInputAttribute( attributeId++ );
+
+                bool isLinked = hybridList[j].first;
+                const char* floatFormat = "%.3f";
+
+                if( isLinked )
+                {
+                    ImGui::PushItemFlag( ImGuiItemFlags_Disabled, true );
+                    floatFormat = "";
+                }
+
+                formatName = memberList.name;
+                formatName.append( " " ).append( std::to_string( j ) );
+
+                if( ImGui::DragFloat( formatName.c_str(), &hybridList[j].second, 0.02f, 0, 0, floatFormat ) )
+                {
+                    node.second.GeneratePreview();
+                }
+
+                if( isLinked )
+                {
+                    ImGui::PopItemFlag();
+                }
+                imnodes::EndInputAttribute();
+            }
+
+            // Attribute IDs are 4 bits per node with 15 reserved for output
+            size_t linkCount = node.second.GetNodeIDLinks().size();
+
+            ImGui::PushID( (int)i );
+            if( hybridList.size() < memberList.countMax && linkCount < 15 && ImGui::SmallButton( "+" ) )
+            {
+                hybridList.emplace_back( nullptr, memberList.valueDefault );
+                node.second.GeneratePreview();
+            }
+            if( hybridList.size() > memberList.countMin )
+            {
+                ImGui::SameLine();
+                if( ImGui::SmallButton( "-" ) )
+                {
+                    hybridList.pop_back();
+                    node.second.GeneratePreview();
+                }
+            }
+            ImGui::PopID();
+        }
+
         for( size_t i = 0; i < nodeMetadata->memberVariables.size(); i++ )
         {
             auto& nodeVar = nodeMetadata->memberVariables[i];
@@ -651,6 +744,21 @@ void FastNoiseNodeEditor::DoNodes()
             }
         }
 
+        for( size_t i = 0; i < nodeMetadata->memberStrings.size(); i++ )
+        {
+            char buffer[256];
+            std::string& nodeString = nodeData->strings[i];
+            snprintf( buffer, sizeof( buffer ), "%s", nodeString.c_str() );
+
+            ImGui::PushItemWidth( 180.0f );
+            if( ImGui::InputText( nodeMetadata->memberStrings[i].name, buffer, sizeof( buffer ) ) )
+            {
+                nodeString = buffer;
+                node.second.GeneratePreview();
+            }
+            ImGui::PopItemWidth();
+        }
+
         ImGui::PopItemWidth();
         imnodes::PopAttributeFlag();
         imnodes::BeginOutputAttribute( Node::GetOutputAttributeId( node.second.GetNodeID() ), imnodes::PinShape_QuadFilled );
@@ -818,7 +926,7 @@ void FastNoiseNodeEditor::DoContextMenu()
 
         auto newMetadata = mContextMetadata.front()->DrawUI( []( const FastNoise::Metadata* metadata )
         {
-            return !metadata->memberNodes.empty() || !metadata->memberHybrids.empty();
+            return !metadata->memberNodes.empty() || !metadata->memberHybrids.empty() || !metadata->memberHybridLists.empty();
         } );
 
         if( newMetadata )
@@ -0,0 +1,106 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Generators/Generator.h"
+
+namespace FastNoise
+{
+    // In process cache of generated uniform grid chunks, bounded by bytes of cached values and evicted least recently used first
+    // Chunks are keyed by treeHash, seed, frequency, start and size, treeHash must identify the node tree content, see HashEncodedNodeTree()
+    // Safe to use from multiple threads, concurrent requests for a chunk that is being generated wait for that generation instead of repeating it
+    // If generation throws, e.g. std::bad_alloc, the exception is rethrown to the caller and every request waiting on it, nothing is cached
+    class ChunkCache
+    {
+    public:
+        struct Chunk
+        {
+            std::vector<float> values;
+            OutputMinMax minMax;
+        };
+
+        // Returned chunks stay valid while referenced, even after eviction
+        using ChunkPtr = std::shared_ptr<const Chunk>;
+
+        struct Counters
+        {
+            uint64_t hits = 0;
+            uint64_t misses = 0;
+
+            // Requests that waited on a generation already in progress, also counted as hits
+            uint64_t inFlightHits = 0;
+            uint64_t evictions = 0;
+            size_t bytes = 0;
+            size_t chunkCount = 0;
+        };
+
+        explicit ChunkCache( size_t maxBytes ) : mMaxBytes( maxBytes ) {}
+
+        ChunkPtr GetUniformGrid2D( const Generator& generator, uint64_t treeHash,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed );
+
+        ChunkPtr GetUniformGrid3D( const Generator& generator, uint64_t treeHash,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed );
+
+        Counters GetCounters() const;
+
+        // Evicts chunks until the cache fits the new size
+        void SetMaxBytes( size_t maxBytes );
+        void Clear();
+
+    private:
+        struct Key
+        {
+            uint64_t treeHash;
+            int32_t seed;
+            uint32_t frequencyBits;
+            int32_t dimensions;
+            int32_t start[3];
+            int32_t size[3];
+
+            bool operator ==( const Key& other ) const;
+        };
+
+        struct KeyHash
+        {
+            size_t operator ()( const Key& key ) const;
+        };
+
+        struct Entry
+        {
+            ChunkPtr chunk;
+            std::list<Key>::iterator lruPosition;
+        };
+
+        template<typename GenerateFunc>
+        ChunkPtr GetChunk( const Key& key, GenerateFunc&& generate );
+
+        void EvictToFit( size_t maxBytes );
+
+        static size_t ChunkBytes( const Chunk& chunk ) { return chunk.values.size() * sizeof( float ); }
+
+        mutable std::mutex mMutex;
+        size_t mMaxBytes;
+        size_t mBytes = 0;
+
+        // Front is most recently used
+        std::list<Key> mLru;
+        std::unordered_map<Key, Entry, KeyHash> mEntries;
+        std::unordered_map<Key, std::shared_future<ChunkPtr>, KeyHash> mInFlight;
+
+        uint64_t mHits = 0;
+        uint64_t mMisses = 0;
+        uint64_t mInFlightHits = 0;
+        uint64_t mEvictions = 0;
+    };
+}
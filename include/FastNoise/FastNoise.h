@@ -15,6 +15,13 @@
 #include "Generators/DomainWarpFractal.h"
 #include "Generators/Modifiers.h"
 #include "Generators/Blends.h"
+#include "Generators/Expression.h"
+#include "Generators/Baked.h"
+#include "Generators/MultiOutput.h"
+#include "SparseVolume.h"
+#include "GridStream.h"
+#include "GridExport.h"
+#include "ChunkCache.h"
 
 namespace FastNoise
 {
@@ -30,4 +37,16 @@ namespace FastNoise
     {
         return Metadata::DeserialiseSmartNode( encodedNodeTreeString, maxLevel );
     }
+
+    // Stable 64 bit FNV-1a hash of an encoded node tree, identifies node tree content for caches and exported files
+    inline uint64_t HashEncodedNodeTree( const char* encodedNodeTreeString )
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+
+        for( ; *encodedNodeTreeString; encodedNodeTreeString++ )
+        {
+            hash = ( hash ^ (uint8_t)*encodedNodeTreeString ) * 0x100000001b3ull;
+        }
+        return hash;
+    }
 }
\ No newline at end of file
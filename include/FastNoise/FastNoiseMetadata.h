@@ -1,7 +1,9 @@
 #pragma once
 #include <functional>
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "FastNoise_Config.h"
@@ -164,6 +166,26 @@ namespace FastNoise
             }
         }
 
+        struct MemberString
+        {
+            const char* name;
+            const char* valueDefault;
+
+            std::function<bool( Generator*, const char* )> setFunc;
+        };
+
+        template<typename U>
+        void AddStringVariable( const char* name, const char* defaultV, bool(U::* func)(const char*) )
+        {
+            MemberString member;
+            member.name = name;
+            member.valueDefault = defaultV;
+
+            member.setFunc = [func]( Generator* g, const char* v ) { return (dynamic_cast<U*>(g)->*func)(v); };
+
+            memberStrings.push_back( member );
+        }
+
         struct MemberNode
         {
             const char* name;
@@ -281,13 +303,60 @@ namespace FastNoise
             }
         }
 
+        struct MemberHybridList
+        {
+            const char* name;
+            float valueDefault = 0.0f;
+            uint8_t countDefault = 2;
+            uint8_t countMin = 0;
+            uint8_t countMax = 8;
+
+            std::function<void( Generator*, size_t )> setCountFunc;
+            std::function<void( Generator*, size_t, float )> setValueFunc;
+            std::function<bool( Generator*, size_t, SmartNodeArg<> )> setNodeFunc;
+        };
+
+        template<typename T, typename U>
+        void AddHybridSourceList( const char* name, float defaultValue, void(U::* funcCount)(size_t), void(U::* funcNode)(size_t, SmartNodeArg<T>), void(U::* funcValue)(size_t, float), uint8_t countDefault = 2, uint8_t countMax = 8 )
+        {
+            MemberHybridList member;
+            member.name = name;
+            member.valueDefault = defaultValue;
+            member.countDefault = countDefault;
+            member.countMax = countMax;
+
+            member.setCountFunc = [funcCount]( Generator* g, size_t count )
+            {
+                (dynamic_cast<U*>(g)->*funcCount)(count);
+            };
+
+            member.setNodeFunc = [funcNode]( Generator* g, size_t idx, SmartNodeArg<> s )
+            {
+                SmartNode<T> downCast = std::dynamic_pointer_cast<T>(s);
+                if( downCast )
+                {
+                    (dynamic_cast<U*>(g)->*funcNode)(idx, downCast);
+                }
+                return (bool)downCast;
+            };
+
+            member.setValueFunc = [funcValue]( Generator* g, size_t idx, float v )
+            {
+                (dynamic_cast<U*>(g)->*funcValue)(idx, v);
+            };
+
+            memberHybridLists.push_back( member );
+        }
+
         uint16_t id;
         const char* name;
         std::vector<const char*> groups;
 
-        std::vector<MemberVariable> memberVariables;
-        std::vector<MemberNode>     memberNodes;
-        std::vector<MemberHybrid>   memberHybrids;
+        std::vector<MemberVariable>   memberVariables;
+        std::vector<MemberNode>       memberNodes;
+        std::vector<MemberHybrid>     memberHybrids;
+        std::vector<MemberHybridList> memberHybridLists;
+        std::vector<MemberString>     memberStrings;
 
         virtual Generator* NodeFactory( FastSIMD::eLevel level = FastSIMD::Level_Null ) const = 0;
 
@@ -300,7 +369,7 @@ namespace FastNoise
         }
 
         static bool SerialiseNodeData( NodeData* nodeData, std::vector<uint8_t>& dataStream, bool fixUp, std::unordered_set<const NodeData*> dependancies = {} );
-        static SmartNode<> DeserialiseSmartNode( const std::vector<uint8_t>& serialisedNodeData, size_t& serialIdx, FastSIMD::eLevel level = FastSIMD::Level_Null );
+        static SmartNode<> DeserialiseSmartNode( const std::vector<uint8_t>& serialisedNodeData, size_t& serialIdx, FastSIMD::eLevel level, std::unordered_map<std::string, SmartNode<>>& sharedNodes );
         static NodeData* DeserialiseNodeData( const std::vector<uint8_t>& serialisedNodeData, std::vector<std::unique_ptr<NodeData>>& nodeDataOut, size_t& serialIdx );
 
         static std::vector<const Metadata*> sMetadataClasses;
@@ -314,13 +383,17 @@ namespace FastNoise
         std::vector<Metadata::MemberVariable::ValueUnion> variables;
         std::vector<NodeData*> nodes;
         std::vector<std::pair<NodeData*, float>> hybrids;
+        std::vector<std::vector<std::pair<NodeData*, float>>> hybridLists;
+        std::vector<std::string> strings;
 
         bool operator ==( const NodeData& rhs ) const
         {
             return metadata == rhs.metadata &&
                 variables == rhs.variables &&
                 nodes == rhs.nodes &&
-                hybrids == rhs.hybrids;
+                hybrids == rhs.hybrids &&
+                hybridLists == rhs.hybridLists &&
+                strings == rhs.strings;
         }
     };
 }
@@ -107,3 +107,30 @@ FASTSIMD_BUILD_CLASS( Max )
 FASTSIMD_BUILD_CLASS( MinSmooth )
 FASTSIMD_BUILD_CLASS( MaxSmooth )
 FASTSIMD_BUILD_CLASS( Fade )
+FASTSIMD_BUILD_CLASS( AddN )
+FASTSIMD_BUILD_CLASS( MultiplyN )
+FASTSIMD_BUILD_CLASS( MinN )
+FASTSIMD_BUILD_CLASS( MaxN )
+
+#ifdef FASTSIMD_INCLUDE_HEADER_ONLY
+#include "Generators/Expression.h"
+#else
+#include "Generators/Expression.inl"
+#endif
+FASTSIMD_BUILD_CLASS( Expression )
+
+FASTSIMD_BUILD_CLASS( Curve ) // Modifiers.h
+
+#ifdef FASTSIMD_INCLUDE_HEADER_ONLY
+#include "Generators/Baked.h"
+#else
+#include "Generators/Baked.inl"
+#endif
+FASTSIMD_BUILD_CLASS( Baked )
+
+#ifdef FASTSIMD_INCLUDE_HEADER_ONLY
+#include "Generators/MultiOutput.h"
+#else
+#include "Generators/MultiOutput.inl"
+#endif
+FASTSIMD_BUILD_CLASS( MultiOutput )
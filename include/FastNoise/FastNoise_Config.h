@@ -1,7 +1,11 @@
 #pragma once
 #include "FastSIMD/FastSIMD.h"
 
+// Min/max returned by the standard generation APIs, disable to remove it from hot paths
+// Generator overloads taking OutputStats gather min/max and other statistics per call regardless of this setting
+#ifndef FASTNOISE_CALC_MIN_MAX
 #define FASTNOISE_CALC_MIN_MAX 1
+#endif
 
 namespace FastNoise
 {
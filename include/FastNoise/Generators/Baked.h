@@ -0,0 +1,78 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Generator.h"
+
+namespace FastNoise
+{
+    // Evaluates the source once into a periodic grid and serves samples by (tri)linear interpolation
+    // The grid repeats every period in each axis, edges are made seamless by blending the source with copies of itself shifted by one period
+    // A grid is baked per seed on first use, up to kMaxBakedSeeds and the memory budget
+    // Resolution is reduced to fit one grid in the budget, seeds that do not fit, or budgets below a kMinResolution grid, sample the source directly
+    // Setters must not be called while generating
+    class Baked : public virtual Generator
+    {
+    public:
+        void SetSource( SmartNodeArg<> gen ) { this->SetSourceMemberVariable( mSource, gen ); Invalidate(); }
+        void SetResolution( int value ) { mResolution = value; Invalidate(); }
+        void SetPeriod( float value ) { mPeriod = value; Invalidate(); }
+        void SetMemoryBudgetMB( float value ) { mMemoryBudgetMB = value; Invalidate(); }
+
+        static const int kMinResolution = 16;
+        static const int kMaxBakedSeeds = 64;
+
+    protected:
+        struct Grid
+        {
+            std::vector<float> values;
+            int resolution = 0;
+            int32_t seed = 0;
+        };
+
+        // Returns the baked grid for the given dimension count (2 or 3) and seed baking it if required
+        // Returns nullptr if the grid does not fit the memory budget
+        const Grid* GetGrid( int dimensions, int32_t seed ) const
+        {
+            int gridIdx = dimensions - 2;
+            size_t gridCount = mGridCount[gridIdx].load( std::memory_order_acquire );
+
+            for( size_t i = 0; i < gridCount; i++ )
+            {
+                if( mGrids[gridIdx][i].seed == seed )
+                {
+                    return &mGrids[gridIdx][i];
+                }
+            }
+            return BakeGrid( dimensions, seed );
+        }
+
+        const Grid* BakeGrid( int dimensions, int32_t seed ) const;
+        int GetBakeResolution( int dimensions ) const;
+        void Invalidate();
+
+        GeneratorSource mSource;
+        int mResolution = 64;
+        float mPeriod = 16.0f;
+        float mMemoryBudgetMB = 16.0f;
+
+        // Storage for kMaxBakedSeeds grids is allocated up front so published grids never move
+        mutable std::mutex mBakeMutex;
+        mutable std::unique_ptr<Grid[]> mGrids[2];
+        mutable std::atomic<size_t> mGridCount[2] = { 0, 0 };
+
+        FASTNOISE_METADATA( Generator )
+
+            Metadata( const char* className ) : Generator::Metadata( className )
+            {
+                groups.push_back( "Modifiers" );
+                this->AddGeneratorSource( "Source", &Baked::SetSource );
+                this->AddVariable( "Resolution", 64, &Baked::SetResolution, kMinResolution, 1024 );
+                this->AddVariable( "Period", 16.0f, &Baked::SetPeriod, 0.0f );
+                this->AddVariable( "Memory Budget MB", 16.0f, &Baked::SetMemoryBudgetMB, 0.0f );
+            }
+        };
+    };
+}
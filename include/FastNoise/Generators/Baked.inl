@@ -0,0 +1,137 @@
+#include <cmath>
+#include "FastSIMD/InlInclude.h"
+
+#include "Baked.h"
+
+template<typename FS>
+class FS_T<FastNoise::Baked, FS> : public virtual FastNoise::Baked, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+
+    template<typename... P>
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        if constexpr( sizeof...( P ) > 3 )
+        {
+            return this->GetSourceValue( mSource, seed, pos... );
+        }
+        else
+        {
+            // Lanes can carry different seeds, each distinct seed samples its own grid
+            int32_t laneSeeds[FS_Size_32()];
+            FS_Store_i32( laneSeeds, seed );
+
+            float32v result( 0 );
+            uint32_t lanesDone = 0;
+
+            for( size_t i = 0; i < FS_Size_32(); i++ )
+            {
+                if( lanesDone & ( 1u << i ) )
+                {
+                    continue;
+                }
+
+                mask32v lanes = FS_Equal_i32( seed, int32v( laneSeeds[i] ) );
+                lanesDone |= FS_MoveMask_m32( lanes );
+
+                float32v value;
+
+                if( const Grid* grid = GetGrid( (int)sizeof...( P ), laneSeeds[i] ) )
+                {
+                    value = SampleGrid( *grid, pos... );
+                }
+                else
+                {
+                    value = this->GetSourceValue( mSource, int32v( laneSeeds[i] ), pos... );
+                }
+
+                result = FS_Select_f32( lanes, value, result );
+            }
+
+            return result;
+        }
+    }
+
+private:
+    template<typename... P>
+    FS_INLINE float32v SampleGrid( const Grid& grid, P... pos ) const
+    {
+        float gridScaleF = mPeriod > 0.0f ? grid.resolution / mPeriod : 1.0f;
+        float32v gridScale( gridScaleF );
+        int32v stride = int32v( 1 );
+
+        // Grid repeats every resolution steps, so only the wrapped large world offset is needed
+        float gridOffset[sizeof...( P )] = {};
+
+        if( const double* offset = GetPositionOffset() )
+        {
+            for( size_t i = 0; i < sizeof...( P ); i++ )
+            {
+                gridOffset[i] = (float)std::fmod( offset[i] * gridScaleF, (double)grid.resolution );
+            }
+        }
+
+        int32v idx0[sizeof...( P )];
+        int32v idx1[sizeof...( P )];
+        float32v t[sizeof...( P )];
+        size_t dim = 0;
+
+        ((WrapAxis( pos * gridScale + float32v( gridOffset[dim] ), grid.resolution, stride, idx0[dim], idx1[dim], t[dim] ), stride *= int32v( grid.resolution ), dim++), ...);
+
+        const float* values = grid.values.data();
+
+        if constexpr( sizeof...( P ) == 2 )
+        {
+            float32v v00 = FS_Gather_f32( values, idx0[0] + idx0[1] );
+            float32v v10 = FS_Gather_f32( values, idx1[0] + idx0[1] );
+            float32v v01 = FS_Gather_f32( values, idx0[0] + idx1[1] );
+            float32v v11 = FS_Gather_f32( values, idx1[0] + idx1[1] );
+
+            float32v x0 = Lerp( v00, v10, t[0] );
+            float32v x1 = Lerp( v01, v11, t[0] );
+
+            return Lerp( x0, x1, t[1] );
+        }
+        else
+        {
+            float32v v000 = FS_Gather_f32( values, idx0[0] + idx0[1] + idx0[2] );
+            float32v v100 = FS_Gather_f32( values, idx1[0] + idx0[1] + idx0[2] );
+            float32v v010 = FS_Gather_f32( values, idx0[0] + idx1[1] + idx0[2] );
+            float32v v110 = FS_Gather_f32( values, idx1[0] + idx1[1] + idx0[2] );
+            float32v v001 = FS_Gather_f32( values, idx0[0] + idx0[1] + idx1[2] );
+            float32v v101 = FS_Gather_f32( values, idx1[0] + idx0[1] + idx1[2] );
+            float32v v011 = FS_Gather_f32( values, idx0[0] + idx1[1] + idx1[2] );
+            float32v v111 = FS_Gather_f32( values, idx1[0] + idx1[1] + idx1[2] );
+
+            float32v x00 = Lerp( v000, v100, t[0] );
+            float32v x10 = Lerp( v010, v110, t[0] );
+            float32v x01 = Lerp( v001, v101, t[0] );
+            float32v x11 = Lerp( v011, v111, t[0] );
+
+            return Lerp( Lerp( x00, x10, t[1] ), Lerp( x01, x11, t[1] ), t[2] );
+        }
+    }
+
+    static FS_INLINE float32v Lerp( float32v a, float32v b, float32v t )
+    {
+        return FS_FMulAdd_f32( b - a, t, a );
+    }
+
+    // Wraps grid position into [0, resolution) and returns the 2 neighbouring grid indices pre-multiplied by stride
+    static FS_INLINE void WrapAxis( float32v gridPos, int resolution, int32v stride, int32v& idx0, int32v& idx1, float32v& t )
+    {
+        float32v resolutionF( (float)resolution );
+
+        gridPos -= FS_Floor_f32( gridPos * float32v( 1.0f / resolution ) ) * resolutionF;
+
+        float32v gridFloor = FS_Floor_f32( gridPos );
+        t = gridPos - gridFloor;
+
+        int32v i0 = FS_Min_i32( FS_Max_i32( FS_Convertf32_i32( gridFloor ), int32v( 0 ) ), int32v( resolution - 1 ) );
+        int32v i1 = FS_NMask_i32( i0 + int32v( 1 ), FS_Equal_i32( i0, int32v( resolution - 1 ) ) );
+
+        idx0 = i0 * stride;
+        idx1 = i1 * stride;
+    }
+};
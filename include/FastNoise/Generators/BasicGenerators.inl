@@ -1,4 +1,5 @@
 #include <cassert>
+#include <cmath>
 #include "FastSIMD/InlInclude.h"
 
 #include "BasicGenerators.h"
@@ -26,8 +27,11 @@ public:
     template<typename... P>
     FS_INLINE float32v GenT( int32v seed, P... pos ) const
     {
+        // Values are hashed from position bits, so large world results only repeat for the same offset
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), pos... );
+
         size_t idx = 0;
-        ((pos = FS_Casti32_f32( (FS_Castf32_i32( pos ) ^ (FS_Castf32_i32( pos ) >> 16)) * int32v( Primes::Lookup[idx++] ) )), ...);
+        ((pos = FS_Casti32_f32( (FS_Castf32_i32( pos ) ^ (FS_Castf32_i32( pos ) >> 16)) * int32v( Primes::Lookup[idx] ) + int32v( offset.primed[idx] ) ), idx++), ...);
 
         return GetValueCoord( seed, FS_Castf32_i32( pos )... );
     }
@@ -44,7 +48,14 @@ public:
     {
         float32v multiplier = FS_Reciprocal_f32( float32v( mSize ) );
 
-        int32v value = (FS_Convertf32_i32( pos * multiplier ) ^ ...);
+        ((pos *= multiplier), ...);
+
+        PositionOffsetScope offsetScope;
+        offsetScope.Scale( 1.0 / mSize );
+
+        // Primes are odd so primed cells keep the parity of the offset cells
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), pos... );
+        int32v value = (FS_Convertf32_i32( pos ) ^ ...) ^ int32v( offset.primed[0] ^ offset.primed[1] ^ offset.primed[2] ^ offset.primed[3] );
 
         return FS_BitwiseXor_f32( float32v( 1.0f ), FS_Casti32_f32( value << 31 ) );
     }
@@ -61,7 +72,16 @@ public:
     {
         float32v multiplier = FS_Reciprocal_f32( float32v( mScale ) );
 
-        return (FS_Sin_f32( pos * multiplier ) * ...);
+        ((pos *= multiplier), ...);
+
+        if( const double* offset = GetPositionOffset() )
+        {
+            // Only the offset phase within one period is needed
+            size_t idx = 0;
+            ((pos += float32v( (float)std::fmod( offset[idx++] / mScale, 6.283185307179586 ) )), ...);
+        }
+
+        return (FS_Sin_f32( pos ) * ...);
     }
 };
 
@@ -78,7 +98,20 @@ public:
         size_t multiplierIdx = 0;
 
         (((pos += float32v( mOffset[offsetIdx++] )) *= float32v( mMultiplier[multiplierIdx++] )), ...);
-        return (pos + ...);
+        float32v sum = (pos + ...);
+
+        // The large world offset's contribution is summed in double and added once
+        if( const double* offset = GetPositionOffset() )
+        {
+            double offsetSum = 0;
+
+            for( size_t i = 0; i < sizeof...( P ); i++ )
+            {
+                offsetSum += offset[i] * mMultiplier[i];
+            }
+            sum = this->AddPositionOffset( sum, offsetSum );
+        }
+        return sum;
     }
 };
 
@@ -91,6 +124,12 @@ public:
     template<typename... P>
     FS_INLINE float32v GenT( int32v seed, P... pos ) const
     {
+        if( const double* offset = GetPositionOffset() )
+        {
+            size_t idx = 0;
+            ((pos = this->AddPositionOffset( pos, offset[idx++] )), ...);
+        }
+
         return CalcDistance( mDistanceFunction, pos... );
     }
 };
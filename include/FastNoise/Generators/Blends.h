@@ -1,4 +1,6 @@
 #pragma once
+#include <vector>
+
 #include "Generator.h"
 
 namespace FastNoise
@@ -48,6 +50,28 @@ namespace FastNoise
         };
     };
 
+    class OperatorSourceList : public virtual Generator
+    {
+    public:
+        void SetSourceCount( size_t count ) { mSources.resize( count ); }
+        void SetSource( size_t index, SmartNodeArg<> gen ) { assert( index < mSources.size() ); this->SetSourceMemberVariable( mSources[index], gen ); }
+        void SetSource( size_t index, float value ) { assert( index < mSources.size() ); mSources[index] = value; }
+        void AddSource( SmartNodeArg<> gen ) { SetSourceCount( mSources.size() + 1 ); SetSource( mSources.size() - 1, gen ); }
+        void AddSource( float value ) { mSources.emplace_back( value ); }
+
+    protected:
+        std::vector<HybridSource> mSources = std::vector<HybridSource>( 2 );
+
+        FASTNOISE_METADATA_ABSTRACT( Generator )
+            
+            Metadata( const char* className ) : Generator::Metadata( className )
+            {
+                groups.push_back( "Blends" );
+                this->AddHybridSourceList( "Source", 0.0f, &OperatorSourceList::SetSourceCount, &OperatorSourceList::SetSource, &OperatorSourceList::SetSource );
+            }
+        };
+    };
+
     class Add : public virtual OperatorSourceLHS
     {
         FASTNOISE_METADATA( OperatorSourceLHS )
@@ -149,4 +173,40 @@ namespace FastNoise
             }
         };    
     };
+
+    class AddN : public virtual OperatorSourceList
+    {
+        FASTNOISE_METADATA( OperatorSourceList )
+            using OperatorSourceList::Metadata::Metadata;
+        };    
+    };
+
+    class MultiplyN : public virtual OperatorSourceList
+    {
+        FASTNOISE_METADATA( OperatorSourceList )
+            using OperatorSourceList::Metadata::Metadata;
+        };    
+    };
+
+    class MinN : public virtual OperatorSourceList
+    {
+        FASTNOISE_METADATA( OperatorSourceList )
+            Metadata( const char* className ) : OperatorSourceList::Metadata( className )
+            {
+                // Min of no sources is undefined
+                memberHybridLists.back().countMin = 1;
+            }
+        };    
+    };
+
+    class MaxN : public virtual OperatorSourceList
+    {
+        FASTNOISE_METADATA( OperatorSourceList )
+            Metadata( const char* className ) : OperatorSourceList::Metadata( className )
+            {
+                // Max of no sources is undefined
+                memberHybridLists.back().countMin = 1;
+            }
+        };    
+    };
 }
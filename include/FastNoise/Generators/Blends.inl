@@ -138,3 +138,96 @@ public:
     }
 };
 
+template<typename FS>
+class FS_T<FastNoise::AddN, FS> : public virtual FastNoise::AddN, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+    
+    template<typename... P> 
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        if( mSources.empty() )
+        {
+            return float32v( 0.0f );
+        }
+
+        float32v value = this->GetSourceValue( mSources[0], seed, pos... );
+
+        for( size_t i = 1; i < mSources.size(); i++ )
+        {
+            value += this->GetSourceValue( mSources[i], seed, pos... );
+        }
+
+        return value;
+    }
+};
+
+template<typename FS>
+class FS_T<FastNoise::MultiplyN, FS> : public virtual FastNoise::MultiplyN, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+    
+    template<typename... P> 
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        if( mSources.empty() )
+        {
+            return float32v( 1.0f );
+        }
+
+        float32v value = this->GetSourceValue( mSources[0], seed, pos... );
+
+        for( size_t i = 1; i < mSources.size(); i++ )
+        {
+            value *= this->GetSourceValue( mSources[i], seed, pos... );
+        }
+
+        return value;
+    }
+};
+
+template<typename FS>
+class FS_T<FastNoise::MinN, FS> : public virtual FastNoise::MinN, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+    
+    template<typename... P> 
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        assert( !mSources.empty() );
+
+        float32v value = this->GetSourceValue( mSources[0], seed, pos... );
+
+        for( size_t i = 1; i < mSources.size(); i++ )
+        {
+            value = FS_Min_f32( value, this->GetSourceValue( mSources[i], seed, pos... ) );
+        }
+
+        return value;
+    }
+};
+
+template<typename FS>
+class FS_T<FastNoise::MaxN, FS> : public virtual FastNoise::MaxN, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+    
+    template<typename... P> 
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        assert( !mSources.empty() );
+
+        float32v value = this->GetSourceValue( mSources[0], seed, pos... );
+
+        for( size_t i = 1; i < mSources.size(); i++ )
+        {
+            value = FS_Max_f32( value, this->GetSourceValue( mSources[i], seed, pos... ) );
+        }
+
+        return value;
+    }
+};
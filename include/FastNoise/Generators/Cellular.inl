@@ -18,6 +18,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y ) const final
     {
         float32v jitter = float32v( kJitter2D ) * this->GetSourceValue( mJitterModifier, seed, x, y );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y );
         std::array<float32v, kMaxDistanceCount> value;
         std::array<float32v, kMaxDistanceCount> distance;
         
@@ -30,8 +31,8 @@ public:
         float32v xcf = FS_Converti32_f32( xc ) - x;
         float32v ycfBase = FS_Converti32_f32( ycBase ) - y;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -83,6 +84,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z ) const final
     {
         float32v jitter = float32v( kJitter3D ) * this->GetSourceValue( mJitterModifier, seed, x, y, z );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z );
         std::array<float32v, kMaxDistanceCount> value;
         std::array<float32v, kMaxDistanceCount> distance;
         
@@ -97,9 +99,9 @@ public:
         float32v ycfBase = FS_Converti32_f32( ycBase ) - y;
         float32v zcfBase = FS_Converti32_f32( zcBase ) - z;
     
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
-        zcBase *= int32v( Primes::Z );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        zcBase = zcBase * int32v( Primes::Z ) + int32v( offset.primed[2] );
     
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -160,6 +162,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z , float32v w ) const final
     {
         float32v jitter = float32v( kJitter4D ) * this->GetSourceValue( mJitterModifier, seed, x, y, z, w );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z, w );
         std::array<float32v, kMaxDistanceCount> value;
         std::array<float32v, kMaxDistanceCount> distance;
         
@@ -176,10 +179,10 @@ public:
         float32v zcfBase = FS_Converti32_f32( zcBase ) - z;
         float32v wcfBase = FS_Converti32_f32( wcBase ) - w;
     
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
-        zcBase *= int32v( Primes::Z );
-        wcBase *= int32v( Primes::W );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        zcBase = zcBase * int32v( Primes::Z ) + int32v( offset.primed[2] );
+        wcBase = wcBase * int32v( Primes::W ) + int32v( offset.primed[3] );
     
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -254,6 +257,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y ) const final
     {
         float32v jitter = float32v( kJitter2D ) * this->GetSourceValue( mJitterModifier, seed, x, y );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y );
 
         std::array<float32v, kMaxDistanceCount> distance;
         distance.fill( float32v( INFINITY ) );
@@ -264,8 +268,8 @@ public:
         float32v xcf = FS_Converti32_f32( xc ) - x;
         float32v ycfBase = FS_Converti32_f32( ycBase ) - y;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -303,6 +307,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z ) const final
     {
         float32v jitter = float32v( kJitter3D ) * this->GetSourceValue( mJitterModifier, seed, x, y, z );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z );
 
         std::array<float32v, kMaxDistanceCount> distance;
         distance.fill( float32v( INFINITY ) );
@@ -315,9 +320,9 @@ public:
         float32v ycfBase = FS_Converti32_f32( ycBase ) - y;
         float32v zcfBase = FS_Converti32_f32( zcBase ) - z;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
-        zcBase *= int32v( Primes::Z );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        zcBase = zcBase * int32v( Primes::Z ) + int32v( offset.primed[2] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -364,6 +369,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z, float32v w ) const final
     {
         float32v jitter = float32v( kJitter4D ) * this->GetSourceValue( mJitterModifier, seed, x, y, z, w );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z, w );
 
         std::array<float32v, kMaxDistanceCount> distance;
         distance.fill( float32v( INFINITY ) );
@@ -378,10 +384,10 @@ public:
         float32v zcfBase = FS_Converti32_f32( zcBase ) - z;
         float32v wcfBase = FS_Converti32_f32( wcBase ) - w;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
-        zcBase *= int32v( Primes::Z );
-        wcBase *= int32v( Primes::W );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        zcBase = zcBase * int32v( Primes::Z ) + int32v( offset.primed[2] );
+        wcBase = wcBase * int32v( Primes::W ) + int32v( offset.primed[3] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -477,6 +483,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y ) const final
     {
         float32v jitter = float32v( kJitter2D ) * this->GetSourceValue( mJitterModifier, seed, x, y );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y );
         float32v distance( FLT_MAX );
         float32v cellX, cellY;
 
@@ -486,8 +493,8 @@ public:
         float32v xcf = FS_Converti32_f32( xc ) - x;
         float32v ycfBase = FS_Converti32_f32( ycBase ) - y;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -518,12 +525,16 @@ public:
             xc += int32v( Primes::X );
         }
 
+        PositionOffsetScope offsetScope;
+        SetLookupOffset( offsetScope );
+
         return this->GetSourceValue( mLookup, seed - int32v( -1 ), cellX * float32v( mLookupFreq ), cellY * float32v( mLookupFreq ) );
     }
 
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z ) const final
     {
         float32v jitter = float32v( kJitter3D ) * this->GetSourceValue( mJitterModifier, seed, x, y, z );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z );
         float32v distance( FLT_MAX );
         float32v cellX, cellY, cellZ;
 
@@ -535,9 +546,9 @@ public:
         float32v ycfBase = FS_Converti32_f32( ycBase ) - y;
         float32v zcfBase = FS_Converti32_f32( zcBase ) - z;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
-        zcBase *= int32v( Primes::Z );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        zcBase = zcBase * int32v( Primes::Z ) + int32v( offset.primed[2] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -578,6 +589,9 @@ public:
             xc += int32v( Primes::X );
         }
 
+        PositionOffsetScope offsetScope;
+        SetLookupOffset( offsetScope );
+
         return this->GetSourceValue( mLookup, seed - int32v( -1 ), cellX * float32v( mLookupFreq ), cellY * float32v( mLookupFreq ), cellZ * float32v( mLookupFreq ) );
     }
 
@@ -585,6 +599,7 @@ public:
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z, float32v w ) const final
     {
         float32v jitter = float32v( kJitter4D ) * this->GetSourceValue( mJitterModifier, seed, x, y, z, w );
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z, w );
         float32v distance( FLT_MAX );
         float32v cellX, cellY, cellZ, cellW;
 
@@ -598,10 +613,10 @@ public:
         float32v zcfBase = FS_Converti32_f32( zcBase ) - z;
         float32v wcfBase = FS_Converti32_f32( wcBase ) - w;
 
-        xc *= int32v( Primes::X );
-        ycBase *= int32v( Primes::Y );
-        zcBase *= int32v( Primes::Z );
-        wcBase *= int32v( Primes::W );
+        xc = xc * int32v( Primes::X ) + int32v( offset.primed[0] );
+        ycBase = ycBase * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        zcBase = zcBase * int32v( Primes::Z ) + int32v( offset.primed[2] );
+        wcBase = wcBase * int32v( Primes::W ) + int32v( offset.primed[3] );
 
         for( int xi = 0; xi < 3; xi++ )
         {
@@ -653,6 +668,22 @@ public:
             xc += int32v( Primes::X );
         }
 
+        PositionOffsetScope offsetScope;
+        SetLookupOffset( offsetScope );
+
         return this->GetSourceValue( mLookup, seed - int32v( -1 ), cellX * float32v( mLookupFreq ), cellY * float32v( mLookupFreq ), cellZ * float32v( mLookupFreq ), cellW * float32v( mLookupFreq ) );
     }
+
+private:
+    // Cell positions are relative to the whole lattice cells of the offset, the lookup source sees those cells at lookup frequency
+    void SetLookupOffset( const PositionOffsetScope& offsetScope ) const
+    {
+        if( offsetScope.Active() )
+        {
+            for( size_t i = 0; i < 4; i++ )
+            {
+                offsetScope.Offset()[i] = std::floor( offsetScope.Offset()[i] ) * mLookupFreq;
+            }
+        }
+    }
 };
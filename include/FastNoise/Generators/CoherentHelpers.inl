@@ -1,4 +1,7 @@
 #pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include "FastSIMD/InlInclude.h"
 
 namespace Primes
@@ -11,6 +14,88 @@ namespace Primes
     static constexpr int32_t Lookup[] = { X,Y,Z,W };
 }
 
+// Large world position offset split into whole lattice cells pre-multiplied by the hash primes and the remaining fraction
+struct LatticeOffset
+{
+    int32_t primed[4] = {};
+    float fraction[4] = {};
+};
+
+// Offsets recently split on this thread, the offset seen by a node is the same for every vector of a call
+// so each node and octave only splits it once per call instead of once per vector
+struct LatticeOffsetMemo
+{
+    static constexpr size_t kEntries = 16;
+
+    struct Entry
+    {
+        size_t dims;
+        double offset[4];
+        LatticeOffset lattice;
+    };
+
+    Entry entries[kEntries];
+    size_t count = 0;
+    size_t next = 0;
+};
+
+inline thread_local LatticeOffsetMemo sLatticeOffsetMemo;
+
+// offset is in lattice space, nullptr gives a zero offset
+inline LatticeOffset SplitLatticeOffset( const double* offset, size_t dims )
+{
+    LatticeOffset lattice;
+
+    if( !offset )
+    {
+        return lattice;
+    }
+
+    LatticeOffsetMemo& memo = sLatticeOffsetMemo;
+
+    for( size_t i = 0; i < memo.count; i++ )
+    {
+        const LatticeOffsetMemo::Entry& entry = memo.entries[i];
+
+        if( entry.dims == dims && std::memcmp( entry.offset, offset, sizeof( double ) * dims ) == 0 )
+        {
+            return entry.lattice;
+        }
+    }
+
+    for( size_t i = 0; i < dims; i++ )
+    {
+        double cell = std::floor( offset[i] );
+
+        // Matches wrapping int32 multiplication done on lattice coords in SIMD
+        lattice.primed[i] = (int32_t)( (uint32_t)(int64_t)cell * (uint32_t)Primes::Lookup[i] );
+        lattice.fraction[i] = (float)( offset[i] - cell );
+    }
+
+    LatticeOffsetMemo::Entry& entry = memo.entries[memo.next];
+    entry.dims = dims;
+    std::memcpy( entry.offset, offset, sizeof( double ) * dims );
+    entry.lattice = lattice;
+
+    memo.next = ( memo.next + 1 ) % LatticeOffsetMemo::kEntries;
+    memo.count = std::max( memo.count, memo.next == 0 ? LatticeOffsetMemo::kEntries : memo.next );
+    return lattice;
+}
+
+// Adds the fractional part of the offset to the positions, the returned primed cells must be added to the primed lattice coords
+template<typename FS = FS_SIMD_CLASS, typename... P>
+FS_INLINE LatticeOffset ApplyLatticeOffset( const double* offset, P&... pos )
+{
+    LatticeOffset lattice = SplitLatticeOffset( offset, sizeof...( P ) );
+
+    if( offset )
+    {
+        size_t idx = 0;
+        ((pos += float32v( lattice.fraction[idx++] )), ...);
+    }
+    return lattice;
+}
+
 #define ROOT2 1.4142135623730950488f
 #define ROOT3 1.7320508075688772935f
 
@@ -19,7 +19,13 @@ public:
     template<typename... P>
     FS_INLINE float32v GenT( int32v seed, P... pos ) const
     {
-        Warp( seed, this->GetSourceValue( mWarpAmplitude, seed, pos... ), (pos * float32v( mWarpFrequency ))..., pos... );
+        float32v warpAmp = this->GetSourceValue( mWarpAmplitude, seed, pos... );
+        {
+            PositionOffsetScope offsetScope;
+            offsetScope.Scale( mWarpFrequency );
+
+            Warp( seed, warpAmp, (pos * float32v( mWarpFrequency ))..., pos... );
+        }
 
         return this->GetSourceValue( mSource, seed, pos...);
     }
@@ -31,11 +37,13 @@ class FS_T<FastNoise::DomainWarpGradient, FS> : public virtual FastNoise::Domain
 public:
     void FS_VECTORCALL Warp( int32v seed, float32v warpAmp, float32v x, float32v y, float32v& xOut, float32v& yOut ) const final
     {
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y );
+
         float32v xs = FS_Floor_f32( x );
         float32v ys = FS_Floor_f32( y );
 
-        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X );
-        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y );
+        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
         int32v x1 = x0 + int32v( Primes::X );
         int32v y1 = y0 + int32v( Primes::Y );
 
@@ -62,13 +70,15 @@ public:
             
     void FS_VECTORCALL Warp( int32v seed, float32v warpAmp, float32v x, float32v y, float32v z, float32v& xOut, float32v& yOut, float32v& zOut ) const final
     {
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z );
+
         float32v xs = FS_Floor_f32( x );
         float32v ys = FS_Floor_f32( y );
         float32v zs = FS_Floor_f32( z );
 
-        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X );
-        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y );
-        int32v z0 = FS_Convertf32_i32( zs ) * int32v( Primes::Z );
+        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        int32v z0 = FS_Convertf32_i32( zs ) * int32v( Primes::Z ) + int32v( offset.primed[2] );
         int32v x1 = x0 + int32v( Primes::X );
         int32v y1 = y0 + int32v( Primes::Y );
         int32v z1 = z0 + int32v( Primes::Z );
@@ -111,15 +121,17 @@ public:
             
     void FS_VECTORCALL Warp( int32v seed, float32v warpAmp, float32v x, float32v y, float32v z, float32v w, float32v& xOut, float32v& yOut, float32v& zOut, float32v& wOut ) const final
     {
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z, w );
+
         float32v xs = FS_Floor_f32( x );
         float32v ys = FS_Floor_f32( y );
         float32v zs = FS_Floor_f32( z );
         float32v ws = FS_Floor_f32( w );
 
-        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X );
-        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y );
-        int32v z0 = FS_Convertf32_i32( zs ) * int32v( Primes::Z );
-        int32v w0 = FS_Convertf32_i32( ws ) * int32v( Primes::W );
+        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        int32v z0 = FS_Convertf32_i32( zs ) * int32v( Primes::Z ) + int32v( offset.primed[2] );
+        int32v w0 = FS_Convertf32_i32( ws ) * int32v( Primes::W ) + int32v( offset.primed[3] );
         int32v x1 = x0 + int32v( Primes::X );
         int32v y1 = y0 + int32v( Primes::Y );
         int32v z1 = z0 + int32v( Primes::Z );
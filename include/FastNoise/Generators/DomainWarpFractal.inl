@@ -12,24 +12,37 @@ public:
     FS_INLINE float32v GenT( int32v seed, P... pos ) const
     {
         float32v amp = float32v( mFractalBounding ) * this->GetSourceValue( this->GetSourceSIMD( mSource )->GetWarpAmplitude(), seed, pos... );
-        float32v freq = float32v( this->GetSourceSIMD( mSource )->GetWarpFrequency() );
+        float freqScalar = this->GetSourceSIMD( mSource )->GetWarpFrequency();
+        float32v freq = float32v( freqScalar );
         int32v seedInc = seed;
 
         float32v gain = this->GetSourceValue( mGain, seed, pos... );
         float32v lacunarity( mLacunarity );
 
-        this->GetSourceSIMD( mSource )->Warp( seedInc, amp, (pos * freq)..., pos... );
+        WarpScaledOffset( freqScalar, seedInc, amp, (pos * freq)..., pos... );
 
         for (int i = 1; i < mOctaves; i++)
         {
             seedInc -= int32v( -1 );
+            freqScalar *= mLacunarity;
             freq *= lacunarity;
             amp *= gain;
-            this->GetSourceSIMD( mSource )->Warp( seedInc, amp, (pos * freq)..., pos... );
+            WarpScaledOffset( freqScalar, seedInc, amp, (pos * freq)..., pos... );
         }
 
         return this->GetSourceValue( mSource, seed, pos... );
     }
+
+private:
+    // Warp positions are the source positions scaled by warp frequency, the large world offset is scaled to match
+    template<typename... P>
+    FS_INLINE void WarpScaledOffset( float frequency, int32v seed, float32v amp, P&&... pos ) const
+    {
+        PositionOffsetScope offsetScope;
+        offsetScope.Scale( frequency );
+
+        this->GetSourceSIMD( mSource )->Warp( seed, amp, std::forward<P>( pos )... );
+    }
 };
 
 template<typename FS>
@@ -44,24 +57,37 @@ public:
         return [this, seed] ( std::remove_reference_t<P>... noisePos, std::remove_reference_t<P>... warpPos )
         {
             float32v amp = float32v( mFractalBounding ) * this->GetSourceValue( this->GetSourceSIMD( mSource )->GetWarpAmplitude(), seed, noisePos... );
-            float32v freq = float32v( this->GetSourceSIMD( mSource )->GetWarpFrequency() );
+            float freqScalar = this->GetSourceSIMD( mSource )->GetWarpFrequency();
+            float32v freq = float32v( freqScalar );
             int32v seedInc = seed;
 
             float32v gain = this->GetSourceValue( mGain, seed, noisePos... );
             float32v lacunarity( mLacunarity );
         
-            this->GetSourceSIMD( mSource )->Warp( seedInc, amp, (noisePos * freq)..., warpPos... );
+            WarpScaledOffset( freqScalar, seedInc, amp, (noisePos * freq)..., warpPos... );
     
             for( int i = 1; i < mOctaves; i++ )
             {
                 seedInc -= int32v( -1 );
+                freqScalar *= mLacunarity;
                 freq *= lacunarity;
                 amp *= gain;
-                this->GetSourceSIMD( mSource )->Warp( seedInc, amp, (noisePos * freq)..., warpPos... );
+                WarpScaledOffset( freqScalar, seedInc, amp, (noisePos * freq)..., warpPos... );
             }
     
             return this->GetSourceValue( mSource, seed, warpPos... );
 
         } ( pos..., pos... );
     }
+
+private:
+    // Warp positions are the source positions scaled by warp frequency, the large world offset is scaled to match
+    template<typename... P>
+    FS_INLINE void WarpScaledOffset( float frequency, int32v seed, float32v amp, P&&... pos ) const
+    {
+        PositionOffsetScope offsetScope;
+        offsetScope.Scale( frequency );
+
+        this->GetSourceSIMD( mSource )->Warp( seed, amp, std::forward<P>( pos )... );
+    }
 };
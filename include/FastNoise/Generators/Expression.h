@@ -0,0 +1,68 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "Blends.h"
+
+namespace FastNoise
+{
+    // Evaluates a math expression over the source list (a, b, c...) and position (x, y, z, w)
+    // Supports + - * / ( ) and min, max, clamp, lerp, abs, sqrt, floor, ceil, round, sin, cos
+    // SetExpression fails if more than kMaxRegisters intermediate values would be live at once
+    class Expression : public virtual OperatorSourceList
+    {
+    public:
+        Expression() { SetExpression( "a" ); }
+
+        bool SetExpression( const char* expression );
+
+        const std::string& GetExpression() const { return mExpression; }
+
+        static const int kMaxRegisters = 32;
+
+    protected:
+        enum class Opcode : uint8_t
+        {
+            Constant,
+            Source,
+            Position,
+            Add,
+            Sub,
+            Mul,
+            Div,
+            Neg,
+            Min,
+            Max,
+            Clamp,
+            Lerp,
+            Abs,
+            Sqrt,
+            Floor,
+            Ceil,
+            Round,
+            Sin,
+            Cos,
+        };
+
+        struct Instruction
+        {
+            Opcode op;
+            uint8_t dst;
+            uint8_t a = 0;
+            uint8_t b = 0;
+            uint8_t c = 0;
+            float constant = 0.0f;
+        };
+
+        std::string mExpression;
+        std::vector<Instruction> mBytecode;
+        uint8_t mResultRegister = 0;
+
+        FASTNOISE_METADATA( OperatorSourceList )
+            Metadata( const char* className ) : OperatorSourceList::Metadata( className )
+            {
+                this->AddStringVariable( "Expression", "a", &Expression::SetExpression );
+            }
+        };
+    };
+}
@@ -0,0 +1,99 @@
+#include "FastSIMD/InlInclude.h"
+
+#include "Expression.h"
+
+template<typename FS>
+class FS_T<FastNoise::Expression, FS> : public virtual FastNoise::Expression, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+
+    template<typename... P>
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        float32v position[4] = { float32v( 0 ), float32v( 0 ), float32v( 0 ), float32v( 0 ) };
+        size_t dim = 0;
+        ((position[dim++] = pos), ...);
+
+        // Expressions see world positions, rounded once to float
+        if( const double* offset = GetPositionOffset() )
+        {
+            for( size_t i = 0; i < sizeof...( P ); i++ )
+            {
+                position[i] = this->AddPositionOffset( position[i], offset[i] );
+            }
+        }
+
+        float32v reg[kMaxRegisters];
+
+        for( const Instruction& instruction : mBytecode )
+        {
+            float32v result;
+
+            switch( instruction.op )
+            {
+            case Opcode::Constant:
+                result = float32v( instruction.constant );
+                break;
+            case Opcode::Source:
+                result = instruction.a < mSources.size() ? this->GetSourceValue( mSources[instruction.a], seed, pos... ) : float32v( 0 );
+                break;
+            case Opcode::Position:
+                result = position[instruction.a];
+                break;
+            case Opcode::Add:
+                result = reg[instruction.a] + reg[instruction.b];
+                break;
+            case Opcode::Sub:
+                result = reg[instruction.a] - reg[instruction.b];
+                break;
+            case Opcode::Mul:
+                result = reg[instruction.a] * reg[instruction.b];
+                break;
+            case Opcode::Div:
+                result = reg[instruction.a] / reg[instruction.b];
+                break;
+            case Opcode::Neg:
+                result = -reg[instruction.a];
+                break;
+            case Opcode::Min:
+                result = FS_Min_f32( reg[instruction.a], reg[instruction.b] );
+                break;
+            case Opcode::Max:
+                result = FS_Max_f32( reg[instruction.a], reg[instruction.b] );
+                break;
+            case Opcode::Clamp:
+                result = FS_Min_f32( FS_Max_f32( reg[instruction.a], reg[instruction.b] ), reg[instruction.c] );
+                break;
+            case Opcode::Lerp:
+                result = FS_FMulAdd_f32( reg[instruction.b] - reg[instruction.a], reg[instruction.c], reg[instruction.a] );
+                break;
+            case Opcode::Abs:
+                result = FS_Abs_f32( reg[instruction.a] );
+                break;
+            case Opcode::Sqrt:
+                result = FS_Sqrt_f32( reg[instruction.a] );
+                break;
+            case Opcode::Floor:
+                result = FS_Floor_f32( reg[instruction.a] );
+                break;
+            case Opcode::Ceil:
+                result = FS_Ceil_f32( reg[instruction.a] );
+                break;
+            case Opcode::Round:
+                result = FS_Round_f32( reg[instruction.a] );
+                break;
+            case Opcode::Sin:
+                result = FS_Sin_f32( reg[instruction.a] );
+                break;
+            case Opcode::Cos:
+                result = FS_Cos_f32( reg[instruction.a] );
+                break;
+            }
+
+            reg[instruction.dst] = result;
+        }
+
+        return reg[mResultRegister];
+    }
+};
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
 #include "FastSIMD/InlInclude.h"
 
 #include "Fractal.h"
@@ -5,7 +8,49 @@
 template<typename FS, typename T>
 class FS_T<FastNoise::Fractal<T>, FS> : public virtual FastNoise::Fractal<T>, public FS_T<FastNoise::Generator, FS>
 {
+protected:
+    static const int32_t kMaxLaneOctaves = 32;
 
+    // Single position query with one octave per SIMD lane, octave i is sampled with seed + i at position * lacunarity^i
+    // combine( octaveValues, gain ) then reduces the octaves in order, so results match the vectorised GenT
+    template<typename Combine, typename... P>
+    FS_INLINE float GenSingleOctaveLanes( Combine combine, int32_t seed, P... pos ) const
+    {
+        GenerationScope generationScope;
+
+        if( this->mOctaves > kMaxLaneOctaves )
+        {
+            return FS_Extract0_f32( this->Gen( int32v( seed ), float32v( pos )... ) );
+        }
+
+        float gain = FS_Extract0_f32( this->GetSourceValue( this->mGain, int32v( seed ), float32v( pos )... ) );
+        float octaveValues[kMaxLaneOctaves];
+
+        for( int32_t octave = 0; octave < this->mOctaves; octave += (int32_t)FS_Size_32() )
+        {
+            float lanePos[sizeof...( P )][FS_Size_32()];
+
+            for( size_t lane = 0; lane < FS_Size_32(); lane++ )
+            {
+                size_t dim = 0;
+                ((lanePos[dim++][lane] = pos), ...);
+                ((pos *= this->mLacunarity), ...);
+            }
+
+            int32v laneSeed = int32v( seed ) + int32v( octave ) + int32v::FS_Incremented();
+
+            FS_Store_f32( &octaveValues[octave], GenOctaveLanes( laneSeed, lanePos, std::make_index_sequence<sizeof...( P )>() ) );
+        }
+
+        return combine( octaveValues, gain );
+    }
+
+private:
+    template<size_t... I>
+    FS_INLINE float32v GenOctaveLanes( int32v seed, const float ( *lanePos )[FS_Size_32()], std::index_sequence<I...> ) const
+    {
+        return this->GetSourceValue( this->mSource, seed, FS_Load_f32( lanePos[I] )... );
+    }
 };
 
 template<typename FS>
@@ -21,17 +66,44 @@ public:
         float32v sum  = this->GetSourceValue( mSource, seed, pos... );
 
         float32v lacunarity( mLacunarity );
+        PositionOffsetScope offsetScope;
         float32v amp( 1 );
 
         for( int i = 1; i < mOctaves; i++ )
         {
             seed -= int32v( -1 );
+            offsetScope.Scale( mLacunarity );
             amp *= gain;
             sum += this->GetSourceValue( mSource, seed, (pos *= lacunarity)... ) * amp;
         }
 
         return sum * float32v( mFractalBounding );
     }
+
+    float GenSingle2D( float x, float y, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y );
+    }
+
+    float GenSingle3D( float x, float y, float z, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y, z );
+    }
+
+private:
+    float CombineOctaves( const float* octaveValues, float gain ) const
+    {
+        float sum = octaveValues[0];
+        float amp = 1;
+
+        for( int i = 1; i < mOctaves; i++ )
+        {
+            amp *= gain;
+            sum += octaveValues[i] * amp;
+        }
+
+        return sum * mFractalBounding;
+    }
 };
 
 template<typename FS>
@@ -47,17 +119,44 @@ public:
         float32v gain = this->GetSourceValue( mGain, seed, pos... );
 
         float32v lacunarity( mLacunarity );
+        PositionOffsetScope offsetScope;
         float32v amp( 1 );
 
         for( int i = 1; i < mOctaves; i++ )
         {
             seed -= int32v( -1 );
+            offsetScope.Scale( mLacunarity );
             amp *= gain;
             sum += (FS_Abs_f32(this->GetSourceValue( mSource, seed, (pos *= lacunarity)... ) ) * float32v( 2 ) - float32v( 1 )) * amp;
         }
 
         return sum * float32v( mFractalBounding );
     }
+
+    float GenSingle2D( float x, float y, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y );
+    }
+
+    float GenSingle3D( float x, float y, float z, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y, z );
+    }
+
+private:
+    float CombineOctaves( const float* octaveValues, float gain ) const
+    {
+        float sum = std::abs( octaveValues[0] ) * 2 - 1;
+        float amp = 1;
+
+        for( int i = 1; i < mOctaves; i++ )
+        {
+            amp *= gain;
+            sum += ( std::abs( octaveValues[i] ) * 2 - 1 ) * amp;
+        }
+
+        return sum * mFractalBounding;
+    }
 };
 
 template<typename FS>
@@ -73,17 +172,44 @@ public:
         float32v gain = this->GetSourceValue( mGain, seed, pos... );
 
         float32v lacunarity( mLacunarity );
+        PositionOffsetScope offsetScope;
         float32v amp( 1 );
 
         for( int i = 1; i < mOctaves; i++ )
         {
             seed -= int32v( -1 );
+            offsetScope.Scale( mLacunarity );
             amp *= gain;
             sum -= (float32v( 1 ) - FS_Abs_f32( this->GetSourceValue( mSource, seed, (pos *= lacunarity)... ) )) * amp;
         }
 
         return sum;
     }
+
+    float GenSingle2D( float x, float y, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y );
+    }
+
+    float GenSingle3D( float x, float y, float z, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y, z );
+    }
+
+private:
+    float CombineOctaves( const float* octaveValues, float gain ) const
+    {
+        float sum = 1 - std::abs( octaveValues[0] );
+        float amp = 1;
+
+        for( int i = 1; i < mOctaves; i++ )
+        {
+            amp *= gain;
+            sum -= ( 1 - std::abs( octaveValues[i] ) ) * amp;
+        }
+
+        return sum;
+    }
 };
 
 template<typename FS>
@@ -100,6 +226,7 @@ public:
         float32v gain = this->GetSourceValue( mGain, seed, pos... ) * float32v( 6 );
         
         float32v lacunarity( mLacunarity );
+        PositionOffsetScope offsetScope;
         float32v amp = sum;
 
         float32v weightAmp( mWeightAmp );
@@ -112,6 +239,7 @@ public:
             amp = FS_Min_f32( FS_Max_f32( amp, float32v( 0 ) ), float32v( 1 ) );
 
             seed -= int32v( -1 );
+            offsetScope.Scale( mLacunarity );
             float32v value = offset - FS_Abs_f32( this->GetSourceValue( mSource, seed, (pos *= lacunarity)... ));
 
             value *= amp;
@@ -125,4 +253,39 @@ public:
 
         return sum * float32v( mWeightBounding ) - offset;
     }
+
+    float GenSingle2D( float x, float y, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y );
+    }
+
+    float GenSingle3D( float x, float y, float z, int32_t seed ) const final
+    {
+        return this->GenSingleOctaveLanes( [this]( const float* octaveValues, float gain ) { return CombineOctaves( octaveValues, gain ); }, seed, x, y, z );
+    }
+
+private:
+    float CombineOctaves( const float* octaveValues, float gain ) const
+    {
+        float sum = 1 - std::abs( octaveValues[0] );
+        float amp = sum;
+        float weight = mWeightAmp;
+
+        gain *= 6;
+
+        for( int i = 1; i < mOctaves; i++ )
+        {
+            amp *= gain;
+            amp = std::min( std::max( amp, 0.0f ), 1.0f );
+
+            float value = ( 1 - std::abs( octaveValues[i] ) ) * amp;
+            amp = value;
+
+            // Match the approximate reciprocal used by GenT at this SIMD level
+            sum += value * FS_Extract0_f32( FS_Reciprocal_f32( float32v( weight ) ) );
+            weight *= mWeightAmp;
+        }
+
+        return sum * mWeightBounding - 1;
+    }
 };
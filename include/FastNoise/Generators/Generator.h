@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <memory>
@@ -7,6 +8,8 @@
 
 namespace FastNoise
 {
+    class SparseVolume;
+
     enum class Dim
     {
         X, Y, Z, W,
@@ -41,6 +44,97 @@ namespace FastNoise
         }
     };
 
+    // Element order of 3D grid outputs
+    // LinearXYZ: x fastest, the default order of GenUniformGrid3D
+    // LinearZYX: z fastest
+    // Bricked4/8: 4^3 or 8^3 bricks in xyz order, each brick stored contiguously in xyz order, sizes must be multiples of the brick size
+    // Morton: Z-order curve over a power of 2 cube, x is the lowest bit of each bit triple
+    enum class GridLayout3D
+    {
+        LinearXYZ,
+        LinearZYX,
+        Bricked4,
+        Bricked8,
+        Morton,
+    };
+
+    // Store hint for the float output APIs taking an OutputStoreHint
+    // NonTemporal streams output past the cache so very large outputs do not evict the data generators need, only useful when the output is larger than the last level cache
+    enum class OutputStoreHint
+    {
+        Default,
+        NonTemporal,
+    };
+
+    // Sample format written by the formatted output APIs
+    // Integer formats clamp values to [rangeMin, rangeMax] and scale them to the full range of the type
+    // rangeMax must not be below rangeMin, an empty range writes the minimum of the type for every value
+    // Half stores the values unscaled as IEEE half precision floats
+    struct OutputFormat
+    {
+        enum Type
+        {
+            Float32,
+            UInt8,
+            UInt16,
+            Int16,
+            Half,
+        };
+
+        Type type = Float32;
+        float rangeMin = -1.0f;
+        float rangeMax = 1.0f;
+
+        size_t GetElementSize() const
+        {
+            switch( type )
+            {
+            case UInt8:
+                return 1;
+            case UInt16:
+            case Int16:
+            case Half:
+                return 2;
+            default:
+                return 4;
+            }
+        }
+    };
+
+    // Statistics gathered by the stats output APIs, set flags and the histogram range before the call
+    // Each statistic is accumulated in vectors only when its flag is set, noiseOut may be nullptr to gather statistics without storing values
+    // Unlike the returned OutputMinMax of other APIs these do not depend on FASTNOISE_CALC_MIN_MAX
+    struct OutputStats
+    {
+        enum Flags : uint32_t
+        {
+            MinMax         = 1 << 0,
+            Moments        = 1 << 1,
+            Histogram      = 1 << 2,
+            AboveThreshold = 1 << 3,
+            All            = MinMax | Moments | Histogram | AboveThreshold,
+        };
+
+        static const int kHistogramBins = 64;
+
+        uint32_t flags = MinMax;
+
+        // Values outside [histogramMin, histogramMax) are counted in the first or last bin
+        float histogramMin = -1.0f;
+        float histogramMax = 1.0f;
+        float threshold = 0.0f;
+
+        // Results
+        OutputMinMax minMax;
+        uint64_t count = 0;
+        double mean = 0;
+        double variance = 0;
+        uint64_t aboveThresholdCount = 0;
+        uint64_t histogram[kHistogramBins] = {};
+
+        double GetFractionAboveThreshold() const { return count ? (double)aboveThresholdCount / count : 0.0; }
+    };
+
     template<typename T>
     struct BaseSource
     {
@@ -49,8 +143,36 @@ namespace FastNoise
         SmartNode<T> base;
         void* simdGeneratorPtr = nullptr;
 
+        // Copies count as another link to the source node, see Generator::IsSharedSource()
+        BaseSource( const BaseSource& other ) : base( other.base ), simdGeneratorPtr( other.simdGeneratorPtr )
+        {
+            AddSourceLink( 1 );
+        }
+
+        BaseSource& operator =( const BaseSource& other )
+        {
+            if( this != &other )
+            {
+                AddSourceLink( -1 );
+                base = other.base;
+                simdGeneratorPtr = other.simdGeneratorPtr;
+                AddSourceLink( 1 );
+            }
+            return *this;
+        }
+
+        ~BaseSource()
+        {
+            AddSourceLink( -1 );
+        }
+
     protected:
         BaseSource() = default;
+
+    private:
+        friend class Generator;
+
+        void AddSourceLink( int delta );
     };
 
     template<typename T>
@@ -78,6 +200,8 @@ namespace FastNoise
 
         virtual FastSIMD::eLevel GetSIMDLevel() const = 0;
 
+        // Buffers only need to hold the values being generated, no padding to the SIMD vector size is required
+
         virtual OutputMinMax GenUniformGrid2D( float* noiseOut,
             int32_t xStart, int32_t yStart,
             int32_t xSize, int32_t ySize,
@@ -96,10 +220,247 @@ namespace FastNoise
             const float* xPosArray, const float* yPosArray, const float* zPosArray, 
             float xOffset, float yOffset, float zOffset, int32_t seed ) const = 0;
 
+        // Per sample seeds: each position is generated with the seed at the same index in seedArray
+
+        virtual OutputMinMax GenPositionArray2D( float* noiseOut, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            float xOffset, float yOffset, const int32_t* seedArray ) const = 0;
+
+        virtual OutputMinMax GenPositionArray3D( float* noiseOut, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            float xOffset, float yOffset, float zOffset, const int32_t* seedArray ) const = 0;
+
+        // Interleaved positions: position i is read as { x, y[, z] } floats from positions + i * byteStride
+        // Use with position structs directly, eg: byteStride = sizeof( Vertex )
+
+        virtual OutputMinMax GenPositionArray2D( float* noiseOut, int32_t count,
+            const void* positions, size_t byteStride,
+            float xOffset, float yOffset, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenPositionArray3D( float* noiseOut, int32_t count,
+            const void* positions, size_t byteStride,
+            float xOffset, float yOffset, float zOffset, int32_t seed ) const = 0;
+
+        // Large world: origin is split into a double precision offset kept out of the float positions
+        // Results keep the same precision far from the origin as near it, grid starts are in grid steps before frequency
+
+        virtual OutputMinMax GenLargeWorldUniformGrid2D( float* noiseOut,
+            int64_t xStart, int64_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenLargeWorldUniformGrid3D( float* noiseOut,
+            int64_t xStart, int64_t yStart, int64_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenLargeWorldPositionArray2D( float* noiseOut, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            double xOffset, double yOffset, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenLargeWorldPositionArray3D( float* noiseOut, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            double xOffset, double yOffset, double zOffset, int32_t seed ) const = 0;
+
+        // Affine grid: sample ( x, y[, z] ) is generated at origin + x * xStep + y * yStep[ + z * zStep ]
+        // Steps are vectors in noise space and include frequency, allowing rotated or sheared grids and non integer steps
+        // A rotated 2D slice through 3D noise is GenAffineGrid3D with zSize = 1
+
+        virtual OutputMinMax GenAffineGrid2D( float* noiseOut,
+            const float origin[2], const float xStep[2], const float yStep[2],
+            int32_t xSize, int32_t ySize, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenAffineGrid3D( float* noiseOut,
+            const float origin[3], const float xStep[3], const float yStep[3], const float zStep[3],
+            int32_t xSize, int32_t ySize, int32_t zSize, int32_t seed ) const = 0;
+
+        // Cube sphere: one tile of a cube face projected onto a sphere of radius centred on the origin, sampled with 3D noise
+        // Faces 0-5 are +X, -X, +Y, -Y, +Z, -Z, each face is resolution x resolution samples
+        // Face samples 0 and resolution - 1 lie on the cube edges, so neighbouring faces share their border samples
+        // The tile covers face samples [xStart, xStart + xSize) x [yStart, yStart + ySize)
+
+        virtual OutputMinMax GenCubeSphereGrid( float* noiseOut, int32_t face,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            int32_t resolution, float radius,
+            float frequency, int32_t seed ) const = 0;
+
         virtual OutputMinMax GenTileable2D( float* noiseOut,
             int32_t xSize,  int32_t ySize, 
             float frequency, int32_t seed ) const = 0;  
 
+        // Pitched output: rows of the grid are written rowPitch elements apart and slices slicePitch elements apart
+        // Generates straight into a sub-rectangle of a larger buffer such as a texture atlas or a chunk with a border apron
+
+        virtual OutputMinMax GenUniformGrid2DPitched( float* noiseOut, size_t rowPitch,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenUniformGrid3DPitched( float* noiseOut, size_t rowPitch, size_t slicePitch,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        // Layout output: coordinates are derived from the output index inside the vector loop, so values land in layout order with no reorder pass
+
+        virtual OutputMinMax GenUniformGrid3D( float* noiseOut, GridLayout3D layout,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        // Store hint output: same as the standard APIs, with NonTemporal full vectors are written with non temporal stores to vector aligned addresses
+        // Values before the first and after the last aligned address use normal stores, a store fence is issued before returning
+
+        virtual OutputMinMax GenUniformGrid2D( float* noiseOut, OutputStoreHint hint,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenUniformGrid3D( float* noiseOut, OutputStoreHint hint,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenPositionArray2D( float* noiseOut, OutputStoreHint hint, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            float xOffset, float yOffset, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenPositionArray3D( float* noiseOut, OutputStoreHint hint, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            float xOffset, float yOffset, float zOffset, int32_t seed ) const = 0;
+
+        // Occupancy output: 1 bit per sample packed into 32 bit words, bit i % 32 of occupancyOut[i / 32] is set when sample i > isoValue
+        // occupancyOut holds ( count + 31 ) / 32 words
+
+        virtual OutputMinMax GenUniformGrid2D( uint32_t* occupancyOut, float isoValue,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenUniformGrid3D( uint32_t* occupancyOut, float isoValue,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        // Band output: 1 byte per sample holding the number of thresholds <= sample
+        // thresholds must be sorted ascending, at most 255 thresholds
+
+        virtual OutputMinMax GenUniformGrid2D( uint8_t* bandOut, const float* thresholds, int32_t thresholdCount,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenUniformGrid3D( uint8_t* bandOut, const float* thresholds, int32_t thresholdCount,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        // Brick min/max output: noiseOut is written as normal and brickMinMaxOut receives the min/max of every brickSize^2 or brickSize^3 block
+        // brickMinMaxOut holds one entry per brick, bricks at the grid edge are clipped, index is ( bz * yBricks + by ) * xBricks + bx, 2D uses by * xBricks + bx
+        // Rows are folded into per column min/max as they complete, so each brick is only reduced horizontally once
+
+        virtual OutputMinMax GenUniformGrid2DBrickMinMax( float* noiseOut, OutputMinMax* brickMinMaxOut, int32_t brickSize,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenUniformGrid3DBrickMinMax( float* noiseOut, OutputMinMax* brickMinMaxOut, int32_t brickSize,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        // Sparse output: the volume is generated brick by brick, brickSize is 4 or 8 and sizes must be multiples of it
+        // Bricks with max - min <= tolerance or entirely on one side of isoValue ( all > isoValue or all <= isoValue ) are stored as a single constant
+        // Pass NAN as isoValue to only collapse bricks within tolerance
+
+        virtual OutputMinMax GenUniformGrid3D( SparseVolume& volumeOut, int32_t brickSize, float isoValue, float tolerance,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        // Formatted output: values are quantised and packed in the store step, noiseOut holds count * format.GetElementSize() bytes
+        // The returned min/max is of the generated values before quantisation
+
+        virtual OutputMinMax GenUniformGrid2D( void* noiseOut, const OutputFormat& format,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenUniformGrid3D( void* noiseOut, const OutputFormat& format,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenPositionArray2D( void* noiseOut, const OutputFormat& format, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            float xOffset, float yOffset, int32_t seed ) const = 0;
+
+        virtual OutputMinMax GenPositionArray3D( void* noiseOut, const OutputFormat& format, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            float xOffset, float yOffset, float zOffset, int32_t seed ) const = 0;
+
+        // Packs already generated values with the same quantisation as the formatted output, e.g. once the range of a buffer is known
+        // Does not generate anything, any generator at the wanted SIMD level can be used
+
+        virtual OutputMinMax QuantiseToFormat( void* noiseOut, const OutputFormat& format, const float* values, size_t count ) const = 0;
+
+        // Stats output: statistics selected by stats.flags are accumulated alongside generation, results are written to stats
+        // noiseOut may be nullptr when only the statistics are needed
+
+        virtual void GenUniformGrid2D( float* noiseOut, OutputStats& stats,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual void GenUniformGrid3D( float* noiseOut, OutputStats& stats,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed ) const = 0;
+
+        virtual void GenPositionArray2D( float* noiseOut, OutputStats& stats, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            float xOffset, float yOffset, int32_t seed ) const = 0;
+
+        virtual void GenPositionArray3D( float* noiseOut, OutputStats& stats, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            float xOffset, float yOffset, float zOffset, int32_t seed ) const = 0;
+
+        // Multi seed: generates the same positions for each of seedCount seeds into noiseOuts[0..seedCount)
+        // Same values as one call per seed, but each position vector is computed once and evaluated for every seed before moving on
+        // minMaxOut is optional and receives one OutputMinMax per seed
+
+        virtual void GenUniformGrid2D( float* const* noiseOuts,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        virtual void GenUniformGrid3D( float* const* noiseOuts,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        virtual void GenPositionArray2D( float* const* noiseOuts, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            float xOffset, float yOffset, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        virtual void GenPositionArray3D( float* const* noiseOuts, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            float xOffset, float yOffset, float zOffset, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        // Low latency: single positions or small batches without min/max tracking or offsets
+        // Small batches use one masked vector per FS_Size_32() positions, count can be below the SIMD vector size
+
+        virtual float GenSingle2D( float x, float y, int32_t seed ) const = 0;
+
+        virtual float GenSingle3D( float x, float y, float z, int32_t seed ) const = 0;
+
+        virtual void GenSmallBatch2D( float* noiseOut, int32_t count,
+            const float* xPosArray, const float* yPosArray, int32_t seed ) const = 0;
+
+        virtual void GenSmallBatch3D( float* noiseOut, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray, int32_t seed ) const = 0;
+
         virtual const Metadata* GetMetadata() = 0;
 
     protected:
@@ -110,14 +471,33 @@ namespace FastNoise
             assert( gen.get() );
             assert( GetSIMDLevel() == gen->GetSIMDLevel() ); // Ensure that all SIMD levels match
 
+            memberVariable.AddSourceLink( -1 );
             memberVariable.base = gen;
+            memberVariable.AddSourceLink( 1 );
             SetSourceSIMDPtr( dynamic_cast<Generator*>( gen.get() ), &memberVariable.simdGeneratorPtr );
         }
 
+        // True if more than one source member references this node, the multi output APIs generate shared nodes once per sample
+        bool IsSharedSource() const { return mSourceLinkCount.load( std::memory_order_relaxed ) > 1; }
+
     private:
+        template<typename T>
+        friend struct BaseSource;
+
         virtual void SetSourceSIMDPtr( Generator* base, void** simdPtr ) = 0;
+
+        std::atomic<int32_t> mSourceLinkCount = 0;
     };
 
+    template<typename T>
+    void BaseSource<T>::AddSourceLink( int delta )
+    {
+        if( base )
+        {
+            static_cast<Generator*>( base.get() )->mSourceLinkCount.fetch_add( delta, std::memory_order_relaxed );
+        }
+    }
+
     using GeneratorSource = GeneratorSourceT<Generator>;
     using HybridSource = HybridSourceT<Generator>;
 
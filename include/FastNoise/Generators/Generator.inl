@@ -1,5 +1,9 @@
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <vector>
 #include "FastSIMD/InlInclude.h"
+#include "FastNoise/SparseVolume.h"
 
 #include "Generator.h"
 
@@ -7,6 +11,94 @@
 #pragma warning( disable:4250 )
 #endif
 
+namespace FastNoise
+{
+    // Offset added to every position passed to Gen, only set by the large world APIs
+    // Nodes that transform positions apply the same transform to the offset while generating their sources
+    // Lattice based nodes fold the whole cells of the offset into their hash primes, so float positions stay small
+    struct PositionOffset
+    {
+        double v[4] = {};
+        bool active = false;
+    };
+
+    inline thread_local PositionOffset sPositionOffset;
+
+    // Values of shared nodes for the vector being generated by a multi output call on this thread, nullptr otherwise
+    // Points to the SharedValueCache of the SIMD level being generated
+    inline thread_local void* sSharedValues = nullptr;
+
+    // Offset used by the next generation call on this thread, set by the large world APIs before forwarding
+    inline thread_local PositionOffset sNextPositionOffset;
+
+    // Started by every generation call, restores the outer offset on destruction so calls made while generating (baking) are safe
+    class GenerationScope
+    {
+    public:
+        GenerationScope() : mPrevious( sPositionOffset ), mPreviousSharedValues( sSharedValues )
+        {
+            sPositionOffset = sNextPositionOffset;
+            sNextPositionOffset = PositionOffset();
+            sSharedValues = nullptr;
+        }
+
+        ~GenerationScope()
+        {
+            sPositionOffset = mPrevious;
+            sSharedValues = mPreviousSharedValues;
+        }
+
+    private:
+        PositionOffset mPrevious;
+        void* mPreviousSharedValues;
+    };
+
+    // Saves the current position offset and restores it on destruction, used to transform the offset seen by source nodes
+    class PositionOffsetScope
+    {
+    public:
+        PositionOffsetScope() : mActive( sPositionOffset.active )
+        {
+            if( mActive )
+            {
+                std::copy( std::begin( sPositionOffset.v ), std::end( sPositionOffset.v ), mPrevious );
+            }
+        }
+
+        ~PositionOffsetScope()
+        {
+            if( mActive )
+            {
+                std::copy( std::begin( mPrevious ), std::end( mPrevious ), sPositionOffset.v );
+            }
+        }
+
+        bool Active() const { return mActive; }
+        double* Offset() const { return sPositionOffset.v; }
+
+        void Scale( double scale ) const
+        {
+            if( mActive )
+            {
+                for( double& v : sPositionOffset.v )
+                {
+                    v *= scale;
+                }
+            }
+        }
+
+    private:
+        bool mActive;
+        double mPrevious[4];
+    };
+
+    // Returns nullptr if there is no large world offset
+    inline const double* GetPositionOffset()
+    {
+        return sPositionOffset.active ? sPositionOffset.v : nullptr;
+    }
+}
+
 template<typename FS>
 class FS_T<FastNoise::Generator, FS> : public virtual FastNoise::Generator
 {
@@ -42,6 +134,11 @@ public:
             auto simdGen = reinterpret_cast<VoidPtrStorageType>( memberVariable.simdGeneratorPtr );
 
             auto simdT = static_cast<FS_T<T, FS>*>( simdGen );
+
+            if( simdGen->IsSharedSource() )
+            {
+                return GetSharedSourceValue( simdT, seed, pos... );
+            }
             return simdT->Gen( seed, pos... );
         }
         return float32v( memberVariable.constant );
@@ -54,6 +151,11 @@ public:
         auto simdGen = reinterpret_cast<VoidPtrStorageType>( memberVariable.simdGeneratorPtr );
 
         auto simdT = static_cast<FS_T<T, FS>*>( simdGen );
+
+        if( simdGen->IsSharedSource() )
+        {
+            return GetSharedSourceValue( simdT, seed, pos... );
+        }
         return simdT->Gen( seed, pos... );
     }
 
@@ -69,28 +171,38 @@ public:
 
     OutputMinMax GenUniformGrid2D( float* noiseOut, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
     {
-        assert( xSize >= (int32_t)FS_Size_32() );
+        GenerationScope generationScope;
 
-        float32v min( INFINITY );
-        float32v max( -INFINITY );
+        LinearWriter writer( noiseOut );
 
-        int32v xIdx( xStart );
-        int32v yIdx( yStart );
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
 
-        float32v freqV( frequency );
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3D( float* noiseOut, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
 
-        int32v xSizeV( xSize );
-        int32v xMax = xSizeV + xIdx + int32v( -1 );
+        LinearWriter writer( noiseOut );
 
-        size_t totalValues = xSize * ySize;
-        size_t index = 0;
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
 
-        xIdx += int32v::FS_Incremented();
+        return writer.Finish();
+    }
+
+    OutputMinMax GenPositionArray2D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
 
-        while( index < totalValues - FS_Size_32() )
+        float32v min( INFINITY );
+        float32v max( -INFINITY );
+
+        int32_t index = 0;
+        while( index < int64_t(count) - int64_t(FS_Size_32()) )
         {
-            float32v xPos = FS_Converti32_f32( xIdx ) * freqV;
-            float32v yPos = FS_Converti32_f32( yIdx ) * freqV;
+            float32v xPos = float32v( xOffset ) + FS_Load_f32( &xPosArray[index] );
+            float32v yPos = float32v( yOffset ) + FS_Load_f32( &yPosArray[index] );
 
             float32v gen = Gen( int32v( seed ), xPos, yPos );
             FS_Store_f32( &noiseOut[index], gen );
@@ -99,51 +211,31 @@ public:
             min = FS_Min_f32( min, gen );
             max = FS_Max_f32( max, gen );
 #endif
-
             index += FS_Size_32();
-            xIdx += int32v( FS_Size_32() );
-
-            mask32v xReset = FS_GreaterThan_i32( xIdx, xMax );
-            yIdx = FS_MaskedIncrement_i32( yIdx, xReset );
-            xIdx = FS_MaskedSub_i32( xIdx, xSizeV, xReset );
         }
 
-        float32v xPos = FS_Converti32_f32( xIdx ) * freqV;
-        float32v yPos = FS_Converti32_f32( yIdx ) * freqV;
+        mask32v remainingMask = RemainingMask( count - index );
+        float32v xPos = float32v( xOffset ) + FS_MaskedLoad_f32( &xPosArray[index], remainingMask );
+        float32v yPos = float32v( yOffset ) + FS_MaskedLoad_f32( &yPosArray[index], remainingMask );
 
         float32v gen = Gen( int32v( seed ), xPos, yPos );
 
-        return DoRemaining( noiseOut, totalValues, index, min, max, gen );
+        return DoRemaining( noiseOut, count, index, min, max, gen );
     }
 
-    OutputMinMax GenUniformGrid3D( float* noiseOut, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    OutputMinMax GenPositionArray3D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, int32_t seed ) const final
     {
-        assert( xSize >= (int32_t)FS_Size_32() );
+        GenerationScope generationScope;
 
         float32v min( INFINITY );
         float32v max( -INFINITY );
 
-        int32v xIdx( xStart );
-        int32v yIdx( yStart );
-        int32v zIdx( zStart );
-
-        float32v freqV( frequency );
-
-        int32v xSizeV( xSize );
-        int32v xMax = xSizeV + xIdx + int32v( -1 );
-        int32v ySizeV( ySize );
-        int32v yMax = ySizeV + yIdx + int32v( -1 );
-
-        size_t totalValues = xSize * ySize * zSize;
-        size_t index = 0;
-
-        xIdx += int32v::FS_Incremented();
-
-        while( index < totalValues - FS_Size_32() )
+        int32_t index = 0;
+        while( index < int64_t(count) - int64_t(FS_Size_32()) )
         {
-            float32v xPos = FS_Converti32_f32( xIdx ) * freqV;
-            float32v yPos = FS_Converti32_f32( yIdx ) * freqV;
-            float32v zPos = FS_Converti32_f32( zIdx ) * freqV;
+            float32v xPos = float32v( xOffset ) + FS_Load_f32( &xPosArray[index] );
+            float32v yPos = float32v( yOffset ) + FS_Load_f32( &yPosArray[index] );
+            float32v zPos = float32v( zOffset ) + FS_Load_f32( &zPosArray[index] );
 
             float32v gen = Gen( int32v( seed ), xPos, yPos, zPos );
             FS_Store_f32( &noiseOut[index], gen );
@@ -152,40 +244,33 @@ public:
             min = FS_Min_f32( min, gen );
             max = FS_Max_f32( max, gen );
 #endif
-
             index += FS_Size_32();
-            xIdx += int32v( FS_Size_32() );
-
-            mask32v xReset = FS_GreaterThan_i32( xIdx, xMax );
-            yIdx = FS_MaskedIncrement_i32( yIdx, xReset );
-            xIdx = FS_MaskedSub_i32( xIdx, xSizeV, xReset );
-
-            mask32v yReset = FS_GreaterThan_i32( yIdx, yMax );
-            zIdx = FS_MaskedIncrement_i32( zIdx, yReset );
-            yIdx = FS_MaskedSub_i32( yIdx, ySizeV, yReset );
         }
 
-        float32v xPos = FS_Converti32_f32( xIdx ) * freqV;
-        float32v yPos = FS_Converti32_f32( yIdx ) * freqV;
-        float32v zPos = FS_Converti32_f32( zIdx ) * freqV;
+        mask32v remainingMask = RemainingMask( count - index );
+        float32v xPos = float32v( xOffset ) + FS_MaskedLoad_f32( &xPosArray[index], remainingMask );
+        float32v yPos = float32v( yOffset ) + FS_MaskedLoad_f32( &yPosArray[index], remainingMask );
+        float32v zPos = float32v( zOffset ) + FS_MaskedLoad_f32( &zPosArray[index], remainingMask );
 
         float32v gen = Gen( int32v( seed ), xPos, yPos, zPos );
 
-        return DoRemaining( noiseOut, totalValues, index, min, max, gen );
+        return DoRemaining( noiseOut, count, index, min, max, gen );
     }
 
-    OutputMinMax GenPositionArray2D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, int32_t seed ) const final
+    OutputMinMax GenPositionArray2D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, const int32_t* seedArray ) const final
     {
+        GenerationScope generationScope;
+
         float32v min( INFINITY );
         float32v max( -INFINITY );
 
-        size_t index = 0;
-        while( index < count - FS_Size_32() )
+        int32_t index = 0;
+        while( index < int64_t(count) - int64_t(FS_Size_32()) )
         {
             float32v xPos = float32v( xOffset ) + FS_Load_f32( &xPosArray[index] );
             float32v yPos = float32v( yOffset ) + FS_Load_f32( &yPosArray[index] );
 
-            float32v gen = Gen( int32v( seed ), xPos, yPos );
+            float32v gen = Gen( FS_Load_i32( &seedArray[index] ), xPos, yPos );
             FS_Store_f32( &noiseOut[index], gen );
 
 #if FASTNOISE_CALC_MIN_MAX
@@ -195,27 +280,30 @@ public:
             index += FS_Size_32();
         }
 
-        float32v xPos = float32v( xOffset ) + FS_Load_f32( &xPosArray[index] );
-        float32v yPos = float32v( yOffset ) + FS_Load_f32( &yPosArray[index] );
+        mask32v remainingMask = RemainingMask( count - index );
+        float32v xPos = float32v( xOffset ) + FS_MaskedLoad_f32( &xPosArray[index], remainingMask );
+        float32v yPos = float32v( yOffset ) + FS_MaskedLoad_f32( &yPosArray[index], remainingMask );
 
-        float32v gen = Gen( int32v( seed ), xPos, yPos );
+        float32v gen = Gen( FS_MaskedLoad_i32( &seedArray[index], remainingMask ), xPos, yPos );
 
         return DoRemaining( noiseOut, count, index, min, max, gen );
     }
 
-    OutputMinMax GenPositionArray3D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, int32_t seed ) const final
+    OutputMinMax GenPositionArray3D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, const int32_t* seedArray ) const final
     {
+        GenerationScope generationScope;
+
         float32v min( INFINITY );
         float32v max( -INFINITY );
 
         int32_t index = 0;
-        while( index < int64_t(count) - FS_Size_32() )
+        while( index < int64_t(count) - int64_t(FS_Size_32()) )
         {
             float32v xPos = float32v( xOffset ) + FS_Load_f32( &xPosArray[index] );
             float32v yPos = float32v( yOffset ) + FS_Load_f32( &yPosArray[index] );
             float32v zPos = float32v( zOffset ) + FS_Load_f32( &zPosArray[index] );
 
-            float32v gen = Gen( int32v( seed ), xPos, yPos, zPos );
+            float32v gen = Gen( FS_Load_i32( &seedArray[index] ), xPos, yPos, zPos );
             FS_Store_f32( &noiseOut[index], gen );
 
 #if FASTNOISE_CALC_MIN_MAX
@@ -225,110 +313,1914 @@ public:
             index += FS_Size_32();
         }
 
-        float32v xPos = float32v( xOffset ) + FS_Load_f32( &xPosArray[index] );
-        float32v yPos = float32v( yOffset ) + FS_Load_f32( &yPosArray[index] );
-        float32v zPos = float32v( zOffset ) + FS_Load_f32( &zPosArray[index] );
+        mask32v remainingMask = RemainingMask( count - index );
+        float32v xPos = float32v( xOffset ) + FS_MaskedLoad_f32( &xPosArray[index], remainingMask );
+        float32v yPos = float32v( yOffset ) + FS_MaskedLoad_f32( &yPosArray[index], remainingMask );
+        float32v zPos = float32v( zOffset ) + FS_MaskedLoad_f32( &zPosArray[index], remainingMask );
 
-        float32v gen = Gen( int32v( seed ), xPos, yPos, zPos );
+        float32v gen = Gen( FS_MaskedLoad_i32( &seedArray[index], remainingMask ), xPos, yPos, zPos );
 
         return DoRemaining( noiseOut, count, index, min, max, gen );
     }
 
-    OutputMinMax GenTileable2D( float* noiseOut, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    OutputMinMax GenPositionArray2D( float* noiseOut, int32_t count, const void* positions, size_t byteStride, float xOffset, float yOffset, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        float32v min( INFINITY );
+        float32v max( -INFINITY );
+
+        const char* positionBytes = reinterpret_cast<const char*>( positions );
+
+        int32_t index = 0;
+        while( index < int64_t(count) - int64_t(FS_Size_32()) )
+        {
+            float32v xPos, yPos;
+            FS_LoadTransposed2_f32( positionBytes + index * byteStride, byteStride, xPos, yPos );
+
+            float32v gen = Gen( int32v( seed ), xPos + float32v( xOffset ), yPos + float32v( yOffset ) );
+            FS_Store_f32( &noiseOut[index], gen );
+
+#if FASTNOISE_CALC_MIN_MAX
+            min = FS_Min_f32( min, gen );
+            max = FS_Max_f32( max, gen );
+#endif
+            index += FS_Size_32();
+        }
+
+        float tail[FS_Size_32() * 2];
+        CopyInterleavedTail( tail, 2, positionBytes, byteStride, index, count );
+
+        float32v xPos, yPos;
+        FS_LoadTransposed2_f32( tail, sizeof( float ) * 2, xPos, yPos );
+
+        float32v gen = Gen( int32v( seed ), xPos + float32v( xOffset ), yPos + float32v( yOffset ) );
+
+        return DoRemaining( noiseOut, count, index, min, max, gen );
+    }
+
+    OutputMinMax GenPositionArray3D( float* noiseOut, int32_t count, const void* positions, size_t byteStride, float xOffset, float yOffset, float zOffset, int32_t seed ) const final
     {
-        assert( xSize >= (int32_t)FS_Size_32() );
+        GenerationScope generationScope;
 
         float32v min( INFINITY );
         float32v max( -INFINITY );
 
-        int32v xIdx( 0 );
-        int32v yIdx( 0 );
+        const char* positionBytes = reinterpret_cast<const char*>( positions );
+
+        int32_t index = 0;
+        while( index < int64_t(count) - int64_t(FS_Size_32()) )
+        {
+            float32v xPos, yPos, zPos;
+            FS_LoadTransposed3_f32( positionBytes + index * byteStride, byteStride, xPos, yPos, zPos );
+
+            float32v gen = Gen( int32v( seed ), xPos + float32v( xOffset ), yPos + float32v( yOffset ), zPos + float32v( zOffset ) );
+            FS_Store_f32( &noiseOut[index], gen );
+
+#if FASTNOISE_CALC_MIN_MAX
+            min = FS_Min_f32( min, gen );
+            max = FS_Max_f32( max, gen );
+#endif
+            index += FS_Size_32();
+        }
+
+        float tail[FS_Size_32() * 3];
+        CopyInterleavedTail( tail, 3, positionBytes, byteStride, index, count );
+
+        float32v xPos, yPos, zPos;
+        FS_LoadTransposed3_f32( tail, sizeof( float ) * 3, xPos, yPos, zPos );
+
+        float32v gen = Gen( int32v( seed ), xPos + float32v( xOffset ), yPos + float32v( yOffset ), zPos + float32v( zOffset ) );
+
+        return DoRemaining( noiseOut, count, index, min, max, gen );
+    }
+
+    OutputMinMax GenLargeWorldUniformGrid2D( float* noiseOut, int64_t xStart, int64_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        SetNextPositionOffset( (double)xStart * frequency, (double)yStart * frequency );
+
+        return GenUniformGrid2D( noiseOut, 0, 0, xSize, ySize, frequency, seed );
+    }
+
+    OutputMinMax GenLargeWorldUniformGrid3D( float* noiseOut, int64_t xStart, int64_t yStart, int64_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        SetNextPositionOffset( (double)xStart * frequency, (double)yStart * frequency, (double)zStart * frequency );
+
+        return GenUniformGrid3D( noiseOut, 0, 0, 0, xSize, ySize, zSize, frequency, seed );
+    }
+
+    OutputMinMax GenLargeWorldPositionArray2D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, double xOffset, double yOffset, int32_t seed ) const final
+    {
+        SetNextPositionOffset( xOffset, yOffset );
+
+        return GenPositionArray2D( noiseOut, count, xPosArray, yPosArray, 0, 0, seed );
+    }
+
+    OutputMinMax GenLargeWorldPositionArray3D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, double xOffset, double yOffset, double zOffset, int32_t seed ) const final
+    {
+        SetNextPositionOffset( xOffset, yOffset, zOffset );
+
+        return GenPositionArray3D( noiseOut, count, xPosArray, yPosArray, zPosArray, 0, 0, 0, seed );
+    }
+
+    OutputMinMax GenAffineGrid2D( float* noiseOut, const float origin[2], const float xStep[2], const float yStep[2], int32_t xSize, int32_t ySize, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        LinearWriter writer( noiseOut );
+
+        float32v xOrigin( origin[0] ), xStepX( xStep[0] ), yStepX( yStep[0] );
+        float32v yOrigin( origin[1] ), xStepY( xStep[1] ), yStepY( yStep[1] );
+
+        IterateGrid2D( 0, 0, xSize, ySize, [&]( size_t index, size_t valueCount, int32v x, int32v y )
+        {
+            float32v xf = FS_Converti32_f32( x );
+            float32v yf = FS_Converti32_f32( y );
+
+            float32v xPos = AffinePos( xOrigin, xStepX, yStepX, xf, yf );
+            float32v yPos = AffinePos( yOrigin, xStepY, yStepY, xf, yf );
+
+            writer.Write( index, valueCount, Gen( int32v( seed ), xPos, yPos ) );
+        } );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenAffineGrid3D( float* noiseOut, const float origin[3], const float xStep[3], const float yStep[3], const float zStep[3], int32_t xSize, int32_t ySize, int32_t zSize, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        LinearWriter writer( noiseOut );
+
+        float32v xOrigin( origin[0] ), xStepX( xStep[0] ), yStepX( yStep[0] ), zStepX( zStep[0] );
+        float32v yOrigin( origin[1] ), xStepY( xStep[1] ), yStepY( yStep[1] ), zStepY( zStep[1] );
+        float32v zOrigin( origin[2] ), xStepZ( xStep[2] ), yStepZ( yStep[2] ), zStepZ( zStep[2] );
+
+        IterateGrid3D( 0, 0, 0, xSize, ySize, zSize, [&]( size_t index, size_t valueCount, int32v x, int32v y, int32v z )
+        {
+            float32v xf = FS_Converti32_f32( x );
+            float32v yf = FS_Converti32_f32( y );
+            float32v zf = FS_Converti32_f32( z );
+
+            float32v xPos = AffinePos( xOrigin, xStepX, yStepX, zStepX, xf, yf, zf );
+            float32v yPos = AffinePos( yOrigin, xStepY, yStepY, zStepY, xf, yf, zf );
+            float32v zPos = AffinePos( zOrigin, xStepZ, yStepZ, zStepZ, xf, yf, zf );
+
+            writer.Write( index, valueCount, Gen( int32v( seed ), xPos, yPos, zPos ) );
+        } );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenCubeSphereGrid( float* noiseOut, int32_t face, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, int32_t resolution, float radius, float frequency, int32_t seed ) const final
+    {
+        assert( face >= 0 && face < 6 && resolution > 1 );
+        GenerationScope generationScope;
+
+        // Face normal, then face space u and v axes
+        static constexpr float kFaceAxes[6][3][3] =
+        {
+            { {  1, 0, 0 }, { 0, 0, -1 }, { 0, 1,  0 } },
+            { { -1, 0, 0 }, { 0, 0,  1 }, { 0, 1,  0 } },
+            { { 0,  1, 0 }, { 1, 0,  0 }, { 0, 0, -1 } },
+            { { 0, -1, 0 }, { 1, 0,  0 }, { 0, 0,  1 } },
+            { { 0, 0,  1 }, {  1, 0, 0 }, { 0, 1,  0 } },
+            { { 0, 0, -1 }, { -1, 0, 0 }, { 0, 1,  0 } },
+        };
+
+        const float ( &axes )[3][3] = kFaceAxes[face];
+        float faceStep = 2.0f / ( resolution - 1 );
+
+        LinearWriter writer( noiseOut );
+
+        // Cube surface point is an affine grid on the face: normal + ( x * faceStep - 1 ) * uAxis + ( y * faceStep - 1 ) * vAxis
+        float32v xOrigin( axes[0][0] - axes[1][0] - axes[2][0] ), xStepX( axes[1][0] * faceStep ), yStepX( axes[2][0] * faceStep );
+        float32v yOrigin( axes[0][1] - axes[1][1] - axes[2][1] ), xStepY( axes[1][1] * faceStep ), yStepY( axes[2][1] * faceStep );
+        float32v zOrigin( axes[0][2] - axes[1][2] - axes[2][2] ), xStepZ( axes[1][2] * faceStep ), yStepZ( axes[2][2] * faceStep );
+
+        float32v radiusFreqV( radius * frequency );
+
+        IterateGrid2D( xStart, yStart, xSize, ySize, [&]( size_t index, size_t valueCount, int32v x, int32v y )
+        {
+            float32v xf = FS_Converti32_f32( x );
+            float32v yf = FS_Converti32_f32( y );
+
+            float32v xPos = AffinePos( xOrigin, xStepX, yStepX, xf, yf );
+            float32v yPos = AffinePos( yOrigin, xStepY, yStepY, xf, yf );
+            float32v zPos = AffinePos( zOrigin, xStepZ, yStepZ, xf, yf );
 
-        int32v xSizeV( xSize );
-        int32v ySizeV( ySize );
-        int32v xMax = xSizeV + xIdx + int32v( -1 );
+            ProjectToSphere( radiusFreqV, xPos, yPos, zPos );
 
-        size_t totalValues = xSize * ySize;
-        size_t index = 0;
+            writer.Write( index, valueCount, Gen( int32v( seed ), xPos, yPos, zPos ) );
+        } );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenTileable2D( float* noiseOut, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        LinearWriter writer( noiseOut );
 
         float32v pi2Recip = float32v( 0.15915493667f );
-        float32v xSizePi = FS_Converti32_f32( xSizeV ) * pi2Recip;
-        float32v ySizePi = FS_Converti32_f32( ySizeV ) * pi2Recip;
+        float32v xSizePi = FS_Converti32_f32( int32v( xSize ) ) * pi2Recip;
+        float32v ySizePi = FS_Converti32_f32( int32v( ySize ) ) * pi2Recip;
         float32v xFreq = float32v( frequency ) * xSizePi;
         float32v yFreq = float32v( frequency ) * ySizePi;
         float32v xMul = float32v( 1 ) / xSizePi;
         float32v yMul = float32v( 1 ) / ySizePi;
 
-        xIdx += int32v::FS_Incremented();
-
-        while( index < totalValues - FS_Size_32() )
+        IterateGrid2D( 0, 0, xSize, ySize, [&]( size_t index, size_t valueCount, int32v x, int32v y )
         {
-            float32v xF = FS_Converti32_f32( xIdx ) * xMul;
-            float32v yF = FS_Converti32_f32( yIdx ) * yMul;
+            float32v xF = FS_Converti32_f32( x ) * xMul;
+            float32v yF = FS_Converti32_f32( y ) * yMul;
 
             float32v xPos = FS_Cos_f32( xF ) * xFreq;
             float32v yPos = FS_Cos_f32( yF ) * yFreq;
             float32v zPos = FS_Sin_f32( xF ) * xFreq;
             float32v wPos = FS_Sin_f32( yF ) * yFreq;
 
-            float32v gen = Gen( int32v( seed ), xPos, yPos, zPos, wPos );
-            FS_Store_f32( &noiseOut[index], gen );
+            writer.Write( index, valueCount, Gen( int32v( seed ), xPos, yPos, zPos, wPos ) );
+        } );
 
-#if FASTNOISE_CALC_MIN_MAX
-            min = FS_Min_f32( min, gen );
-            max = FS_Max_f32( max, gen );
-#endif
+        return writer.Finish();
+    }
 
-            index += FS_Size_32();
-            xIdx += int32v( FS_Size_32() );
+    OutputMinMax GenUniformGrid2D( void* noiseOut, const OutputFormat& format, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        FormatWriter writer( noiseOut, format );
 
-            mask32v xReset = FS_GreaterThan_i32( xIdx, xMax );
-            yIdx = FS_MaskedIncrement_i32( yIdx, xReset );
-            xIdx = FS_MaskedSub_i32( xIdx, xSizeV, xReset );
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3D( void* noiseOut, const OutputFormat& format, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        FormatWriter writer( noiseOut, format );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid2DPitched( float* noiseOut, size_t rowPitch, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        assert( rowPitch >= (size_t)xSize );
+        GenerationScope generationScope;
+
+        PitchedWriter writer( noiseOut, rowPitch, 0, xSize, ySize );
+
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3DPitched( float* noiseOut, size_t rowPitch, size_t slicePitch, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        assert( rowPitch >= (size_t)xSize && slicePitch >= rowPitch * ySize );
+        GenerationScope generationScope;
+
+        PitchedWriter writer( noiseOut, rowPitch, slicePitch, xSize, ySize );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3D( float* noiseOut, GridLayout3D layout, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        LinearWriter writer( noiseOut );
+
+        IterateUniformGrid3D( writer, layout, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid2D( float* noiseOut, OutputStoreHint hint, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        if( hint != OutputStoreHint::NonTemporal )
+        {
+            return GenUniformGrid2D( noiseOut, xStart, yStart, xSize, ySize, frequency, seed );
         }
 
-        float32v xF = FS_Converti32_f32( xIdx ) * xMul;
-        float32v yF = FS_Converti32_f32( yIdx ) * yMul;
+        GenerationScope generationScope;
 
-        float32v xPos = FS_Cos_f32( xF ) * xFreq;
-        float32v yPos = FS_Cos_f32( yF ) * yFreq;
-        float32v zPos = FS_Sin_f32( xF ) * xFreq;
-        float32v wPos = FS_Sin_f32( yF ) * yFreq;
+        NonTemporalWriter writer( noiseOut );
 
-        float32v gen = Gen( int32v( seed ), xPos, yPos, yPos, wPos );
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
 
-        return DoRemaining( noiseOut, totalValues, index, min, max, gen );
+        return writer.Finish();
     }
 
-private:
-    static FS_INLINE OutputMinMax DoRemaining( float* noiseOut, size_t totalValues, size_t index, float32v min, float32v max, float32v finalGen )
+    OutputMinMax GenUniformGrid3D( float* noiseOut, OutputStoreHint hint, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
     {
-        OutputMinMax minMax;
-        size_t remaining = totalValues - index;
+        if( hint != OutputStoreHint::NonTemporal )
+        {
+            return GenUniformGrid3D( noiseOut, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+        }
+
+        GenerationScope generationScope;
+
+        NonTemporalWriter writer( noiseOut );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenPositionArray2D( float* noiseOut, OutputStoreHint hint, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, int32_t seed ) const final
+    {
+        if( hint != OutputStoreHint::NonTemporal )
+        {
+            return GenPositionArray2D( noiseOut, count, xPosArray, yPosArray, xOffset, yOffset, seed );
+        }
+
+        GenerationScope generationScope;
 
-        if( remaining == FS_Size_32() )
+        NonTemporalWriter writer( noiseOut );
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
         {
-            FS_Store_f32( &noiseOut[index], finalGen );
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
 
-#if FASTNOISE_CALC_MIN_MAX
-            min = FS_Min_f32( min, finalGen );
-            max = FS_Max_f32( max, finalGen );
-#endif
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos ) );
+        }
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenPositionArray3D( float* noiseOut, OutputStoreHint hint, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, int32_t seed ) const final
+    {
+        if( hint != OutputStoreHint::NonTemporal )
+        {
+            return GenPositionArray3D( noiseOut, count, xPosArray, yPosArray, zPosArray, xOffset, yOffset, zOffset, seed );
         }
-        else
+
+        GenerationScope generationScope;
+
+        NonTemporalWriter writer( noiseOut );
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
         {
-            memcpy( &noiseOut[index], &finalGen, remaining * sizeof( int32_t ) );
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+            float32v zPos = float32v( zOffset ) + LoadRemaining( &zPosArray[index], count - index );
 
-#if FASTNOISE_CALC_MIN_MAX
-            do
-            {
-                minMax << noiseOut[index];
-            }
-            while( ++index < totalValues );
-#endif
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos, zPos ) );
         }
 
-#if FASTNOISE_CALC_MIN_MAX
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid2D( uint32_t* occupancyOut, float isoValue, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        OccupancyWriter writer( occupancyOut, isoValue, (size_t)xSize * ySize );
+
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3D( uint32_t* occupancyOut, float isoValue, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        OccupancyWriter writer( occupancyOut, isoValue, (size_t)xSize * ySize * zSize );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid2D( uint8_t* bandOut, const float* thresholds, int32_t thresholdCount, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        BandWriter writer( bandOut, thresholds, thresholdCount );
+
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3D( uint8_t* bandOut, const float* thresholds, int32_t thresholdCount, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        BandWriter writer( bandOut, thresholds, thresholdCount );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    void GenUniformGrid2D( float* noiseOut, OutputStats& stats, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        StatsWriter writer( noiseOut, stats );
+
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
+
+        writer.Finish();
+    }
+
+    void GenUniformGrid3D( float* noiseOut, OutputStats& stats, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        StatsWriter writer( noiseOut, stats );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        writer.Finish();
+    }
+
+    void GenPositionArray2D( float* noiseOut, OutputStats& stats, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        StatsWriter writer( noiseOut, stats );
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
+        {
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos ) );
+        }
+
+        writer.Finish();
+    }
+
+    void GenPositionArray3D( float* noiseOut, OutputStats& stats, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        StatsWriter writer( noiseOut, stats );
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
+        {
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+            float32v zPos = float32v( zOffset ) + LoadRemaining( &zPosArray[index], count - index );
+
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos, zPos ) );
+        }
+
+        writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid2DBrickMinMax( float* noiseOut, OutputMinMax* brickMinMaxOut, int32_t brickSize, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        // 2D rows are handled as slices of a single row, so bricks are flushed every brickSize rows
+        BrickMinMaxWriter writer( noiseOut, brickMinMaxOut, brickSize, xSize, 1, ySize, brickSize );
+
+        IterateUniformGrid2D( writer, xStart, yStart, xSize, ySize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3DBrickMinMax( float* noiseOut, OutputMinMax* brickMinMaxOut, int32_t brickSize, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        BrickMinMaxWriter writer( noiseOut, brickMinMaxOut, brickSize, xSize, ySize, zSize, brickSize );
+
+        IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenUniformGrid3D( SparseVolume& volumeOut, int32_t brickSize, float isoValue, float tolerance, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const final
+    {
+        assert( brickSize == 4 || brickSize == 8 );
+        GenerationScope generationScope;
+
+        volumeOut.Reset( brickSize, xSize, ySize, zSize );
+
+        SparseBrickWriter writer( volumeOut, brickSize, isoValue, tolerance );
+
+        IterateUniformGrid3D( writer, brickSize == 4 ? GridLayout3D::Bricked4 : GridLayout3D::Bricked8, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+
+        return writer.minMax;
+    }
+
+    OutputMinMax GenPositionArray2D( void* noiseOut, const OutputFormat& format, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        FormatWriter writer( noiseOut, format );
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
+        {
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos ) );
+        }
+
+        return writer.Finish();
+    }
+
+    OutputMinMax GenPositionArray3D( void* noiseOut, const OutputFormat& format, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        FormatWriter writer( noiseOut, format );
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
+        {
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+            float32v zPos = float32v( zOffset ) + LoadRemaining( &zPosArray[index], count - index );
+
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos, zPos ) );
+        }
+
+        return writer.Finish();
+    }
+
+    OutputMinMax QuantiseToFormat( void* noiseOut, const OutputFormat& format, const float* values, size_t count ) const final
+    {
+        FormatWriter writer( noiseOut, format );
+
+        for( size_t index = 0; index < count; index += FS_Size_32() )
+        {
+            writer.Write( index, std::min<size_t>( count - index, FS_Size_32() ), LoadRemaining( &values[index], count - index ) );
+        }
+
+        return writer.Finish();
+    }
+
+    void GenUniformGrid2D( float* const* noiseOuts, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( seedCount, noiseOuts, 1, minMaxOut );
+        float32v freqV( frequency );
+
+        IterateGrid2D( xStart, yStart, xSize, ySize, [&]( size_t index, size_t valueCount, int32v x, int32v y )
+        {
+            float32v xPos = FS_Converti32_f32( x ) * freqV;
+            float32v yPos = FS_Converti32_f32( y ) * freqV;
+
+            for( int32_t i = 0; i < seedCount; i++ )
+            {
+                writer.Write( i, index, valueCount, Gen( int32v( seeds[i] ), xPos, yPos ) );
+            }
+        } );
+
+        writer.Finish();
+    }
+
+    void GenUniformGrid3D( float* const* noiseOuts, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( seedCount, noiseOuts, 1, minMaxOut );
+        float32v freqV( frequency );
+
+        IterateGrid3D( xStart, yStart, zStart, xSize, ySize, zSize, [&]( size_t index, size_t valueCount, int32v x, int32v y, int32v z )
+        {
+            float32v xPos = FS_Converti32_f32( x ) * freqV;
+            float32v yPos = FS_Converti32_f32( y ) * freqV;
+            float32v zPos = FS_Converti32_f32( z ) * freqV;
+
+            for( int32_t i = 0; i < seedCount; i++ )
+            {
+                writer.Write( i, index, valueCount, Gen( int32v( seeds[i] ), xPos, yPos, zPos ) );
+            }
+        } );
+
+        writer.Finish();
+    }
+
+    void GenPositionArray2D( float* const* noiseOuts, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( seedCount, noiseOuts, 1, minMaxOut );
+
+        for( size_t index = 0; index < (size_t)count; index += FS_Size_32() )
+        {
+            size_t valueCount = std::min<size_t>( count - index, FS_Size_32() );
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+
+            for( int32_t i = 0; i < seedCount; i++ )
+            {
+                writer.Write( i, index, valueCount, Gen( int32v( seeds[i] ), xPos, yPos ) );
+            }
+        }
+
+        writer.Finish();
+    }
+
+    void GenPositionArray3D( float* const* noiseOuts, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, const int32_t* seeds, int32_t seedCount, OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( seedCount, noiseOuts, 1, minMaxOut );
+
+        for( size_t index = 0; index < (size_t)count; index += FS_Size_32() )
+        {
+            size_t valueCount = std::min<size_t>( count - index, FS_Size_32() );
+            float32v xPos = float32v( xOffset ) + LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + LoadRemaining( &yPosArray[index], count - index );
+            float32v zPos = float32v( zOffset ) + LoadRemaining( &zPosArray[index], count - index );
+
+            for( int32_t i = 0; i < seedCount; i++ )
+            {
+                writer.Write( i, index, valueCount, Gen( int32v( seeds[i] ), xPos, yPos, zPos ) );
+            }
+        }
+
+        writer.Finish();
+    }
+
+    // Not final, fractals override the single position queries to evaluate octaves in parallel
+    float GenSingle2D( float x, float y, int32_t seed ) const override
+    {
+        GenerationScope generationScope;
+
+        return FS_Extract0_f32( Gen( int32v( seed ), float32v( x ), float32v( y ) ) );
+    }
+
+    float GenSingle3D( float x, float y, float z, int32_t seed ) const override
+    {
+        GenerationScope generationScope;
+
+        return FS_Extract0_f32( Gen( int32v( seed ), float32v( x ), float32v( y ), float32v( z ) ) );
+    }
+
+    void GenSmallBatch2D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
+        {
+            mask32v remainingMask = RemainingMask( count - index );
+
+            float32v xPos = FS_MaskedLoad_f32( &xPosArray[index], remainingMask );
+            float32v yPos = FS_MaskedLoad_f32( &yPosArray[index], remainingMask );
+
+            FS_MaskedStore_f32( &noiseOut[index], Gen( int32v( seed ), xPos, yPos ), remainingMask );
+        }
+    }
+
+    void GenSmallBatch3D( float* noiseOut, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, int32_t seed ) const final
+    {
+        GenerationScope generationScope;
+
+        for( int32_t index = 0; index < count; index += (int32_t)FS_Size_32() )
+        {
+            mask32v remainingMask = RemainingMask( count - index );
+
+            float32v xPos = FS_MaskedLoad_f32( &xPosArray[index], remainingMask );
+            float32v yPos = FS_MaskedLoad_f32( &yPosArray[index], remainingMask );
+            float32v zPos = FS_MaskedLoad_f32( &zPosArray[index], remainingMask );
+
+            FS_MaskedStore_f32( &noiseOut[index], Gen( int32v( seed ), xPos, yPos, zPos ), remainingMask );
+        }
+    }
+
+protected:
+    // Elements below remaining are set, used for the final partial vector of a buffer
+    static FS_INLINE mask32v RemainingMask( size_t remaining )
+    {
+        return FS_LessThan_i32( int32v::FS_Incremented(), int32v( (int32_t)std::min<size_t>( remaining, FS_Size_32() ) ) );
+    }
+
+    // Adds a large world offset to a position rounding only once, the offset is split into a float and the float remainder
+    // Casting the offset to float first would lose up to half a unit at 1e7 before the position is even added
+    static FS_INLINE float32v AddPositionOffset( float32v pos, double offset )
+    {
+        float high = (float)offset;
+        float low = (float)( offset - high );
+
+        return ( pos + float32v( low ) ) + float32v( high );
+    }
+
+    // Full vector load unless fewer values remain, never reads past ptr[remaining - 1]
+    static FS_INLINE float32v LoadRemaining( const float* ptr, size_t remaining )
+    {
+        if( remaining >= FS_Size_32() )
+        {
+            return FS_Load_f32( ptr );
+        }
+        return FS_MaskedLoad_f32( ptr, RemainingMask( remaining ) );
+    }
+
+    // Values of nodes with more than one parent generated for the current vector, keyed by node and exact inputs
+    // Active while a multi output call evaluates its outputs, so subtrees shared between outputs are generated once per sample
+    struct SharedValueCache
+    {
+        static constexpr size_t kMaxEntries = 32;
+
+        struct Entry
+        {
+            const void* node;
+            size_t dimensions;
+            int32v seed;
+            int32v pos[4];
+            float32v value;
+        };
+
+        // Called before each vector is generated
+        void Reset() { count = 0; }
+
+        Entry entries[kMaxEntries];
+        size_t count = 0;
+    };
+
+    // Enables the shared value cache on this thread until destruction, must be created after the GenerationScope of the call
+    class SharedValueScope
+    {
+    public:
+        SharedValueScope( SharedValueCache& cache ) : mPrevious( sSharedValues ) { sSharedValues = &cache; }
+        ~SharedValueScope() { sSharedValues = mPrevious; }
+
+    private:
+        void* mPrevious;
+    };
+
+    template<typename T, typename... POS>
+    float32v FS_VECTORCALL GetSharedSourceValue( const FS_T<T, FS>* simdT, int32v seed, POS... pos ) const
+    {
+        auto cache = static_cast<SharedValueCache*>( sSharedValues );
+
+        // Values depend on the large world offset too, which is not part of the key
+        if( !cache || sPositionOffset.active )
+        {
+            return simdT->Gen( seed, pos... );
+        }
+
+        int32v posBits[] = { FS_Castf32_i32( pos )... };
+        constexpr uint32_t kAllLanes = (uint32_t)( ( 1ull << FS_Size_32() ) - 1 );
+
+        for( size_t i = 0; i < cache->count; i++ )
+        {
+            const typename SharedValueCache::Entry& entry = cache->entries[i];
+
+            if( entry.node != simdT || entry.dimensions != sizeof...( POS ) )
+            {
+                continue;
+            }
+
+            int32v difference = entry.seed ^ seed;
+
+            for( size_t d = 0; d < sizeof...( POS ); d++ )
+            {
+                difference |= entry.pos[d] ^ posBits[d];
+            }
+
+            if( FS_MoveMask_m32( FS_Equal_i32( difference, int32v( 0 ) ) ) == kAllLanes )
+            {
+                return entry.value;
+            }
+        }
+
+        float32v value = simdT->Gen( seed, pos... );
+
+        // Sources generated above may have added entries
+        if( cache->count < SharedValueCache::kMaxEntries )
+        {
+            typename SharedValueCache::Entry& entry = cache->entries[cache->count++];
+            entry.node = simdT;
+            entry.dimensions = sizeof...( POS );
+            entry.seed = seed;
+            entry.value = value;
+
+            for( size_t d = 0; d < sizeof...( POS ); d++ )
+            {
+                entry.pos[d] = posBits[d];
+            }
+        }
+        return value;
+    }
+
+    // Writes one vector per output to a set of output buffers, each output value is elementStride floats apart
+    // Optional min/max is accumulated per output in vectors and reduced in Finish()
+    struct MultiOutputWriter
+    {
+        MultiOutputWriter( size_t outputCount, float* const* outs, size_t stride, OutputMinMax* minMaxOut ) :
+            noiseOuts( outs ), elementStride( stride ), minMax( minMaxOut )
+        {
+            if( minMax )
+            {
+                min.assign( outputCount, float32v( INFINITY ) );
+                max.assign( outputCount, float32v( -INFINITY ) );
+            }
+        }
+
+        FS_INLINE void Write( size_t output, size_t index, size_t valueCount, float32v gen )
+        {
+            float* out = noiseOuts[output] + index * elementStride;
+
+            if( valueCount == FS_Size_32() )
+            {
+                if( elementStride == 1 )
+                {
+                    FS_Store_f32( out, gen );
+                }
+                else
+                {
+                    StoreStrided( out, valueCount, gen );
+                }
+
+                if( minMax )
+                {
+                    min[output] = FS_Min_f32( min[output], gen );
+                    max[output] = FS_Max_f32( max[output], gen );
+                }
+            }
+            else
+            {
+                mask32v valueMask = RemainingMask( valueCount );
+
+                if( elementStride == 1 )
+                {
+                    FS_MaskedStore_f32( out, gen, valueMask );
+                }
+                else
+                {
+                    StoreStrided( out, valueCount, gen );
+                }
+
+                if( minMax )
+                {
+                    min[output] = FS_Select_f32( valueMask, FS_Min_f32( min[output], gen ), min[output] );
+                    max[output] = FS_Select_f32( valueMask, FS_Max_f32( max[output], gen ), max[output] );
+                }
+            }
+        }
+
+        void Finish()
+        {
+            for( size_t i = 0; i < min.size(); i++ )
+            {
+                float* minP = reinterpret_cast<float*>( &min[i] );
+                float* maxP = reinterpret_cast<float*>( &max[i] );
+
+                minMax[i] = OutputMinMax();
+                for( size_t j = 0; j < FS_Size_32(); j++ )
+                {
+                    minMax[i] << OutputMinMax{ minP[j], maxP[j] };
+                }
+            }
+        }
+
+        float* const* noiseOuts;
+        size_t elementStride;
+        OutputMinMax* minMax;
+        std::vector<float32v> min;
+        std::vector<float32v> max;
+
+    private:
+        FS_INLINE void StoreStrided( float* out, size_t valueCount, float32v gen ) const
+        {
+            float values[FS_Size_32()];
+            FS_Store_f32( values, gen );
+
+            for( size_t j = 0; j < valueCount; j++ )
+            {
+                out[j * elementStride] = values[j];
+            }
+        }
+    };
+
+    // Accumulates min/max of the written values in vectors, MinMaxAccumulator is only enabled with FASTNOISE_CALC_MIN_MAX
+    template<bool Enabled>
+    struct MinMaxAccumulatorT
+    {
+        FS_INLINE void Add( size_t valueCount, float32v gen )
+        {
+            if constexpr( !Enabled )
+            {
+                return;
+            }
+
+            if( valueCount == FS_Size_32() )
+            {
+                min = FS_Min_f32( min, gen );
+                max = FS_Max_f32( max, gen );
+            }
+            else
+            {
+                mask32v valueMask = RemainingMask( valueCount );
+                min = FS_Select_f32( valueMask, FS_Min_f32( min, gen ), min );
+                max = FS_Select_f32( valueMask, FS_Max_f32( max, gen ), max );
+            }
+        }
+
+        OutputMinMax Finish()
+        {
+            OutputMinMax minMax;
+
+            if constexpr( Enabled )
+            {
+                float* minP = reinterpret_cast<float*>( &min );
+                float* maxP = reinterpret_cast<float*>( &max );
+                for( size_t i = 0; i < FS_Size_32(); i++ )
+                {
+                    minMax << OutputMinMax{ minP[i], maxP[i] };
+                }
+            }
+            return minMax;
+        }
+
+        float32v min = float32v( INFINITY );
+        float32v max = float32v( -INFINITY );
+    };
+
+    using MinMaxAccumulator = MinMaxAccumulatorT<FASTNOISE_CALC_MIN_MAX != 0>;
+
+    // Quantises and packs one vector at a time into the requested output format
+    // Min/max is accumulated from the values before quantisation
+    struct FormatWriter
+    {
+        FormatWriter( void* out, const OutputFormat& outputFormat ) :
+            noiseOut( static_cast<uint8_t*>( out ) ), type( outputFormat.type ), elementSize( outputFormat.GetElementSize() )
+        {
+            float typeMin = 0, typeMax = 0;
+
+            switch( type )
+            {
+            case OutputFormat::UInt8:
+                typeMax = 255;
+                break;
+            case OutputFormat::UInt16:
+                typeMax = 65535;
+                break;
+            case OutputFormat::Int16:
+                typeMin = -32768;
+                typeMax = 32767;
+                break;
+            default:
+                break;
+            }
+
+            assert( outputFormat.rangeMax >= outputFormat.rangeMin );
+
+            // An empty range quantises everything to typeMin instead of scaling by inf
+            float scale = outputFormat.rangeMax > outputFormat.rangeMin ? ( typeMax - typeMin ) / ( outputFormat.rangeMax - outputFormat.rangeMin ) : 0.0f;
+
+            quantiseScale = float32v( scale );
+            quantiseOffset = float32v( typeMin - outputFormat.rangeMin * scale );
+            quantiseMin = float32v( typeMin );
+            quantiseMax = float32v( typeMax );
+        }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            uint8_t* out = noiseOut + index * elementSize;
+
+            if( valueCount == FS_Size_32() )
+            {
+                Store( out, gen );
+            }
+            else
+            {
+                // Pack the full vector then copy only the remaining values, the packed stores always write a full vector
+                uint8_t tail[FS_Size_32() * sizeof( float )];
+                Store( tail, gen );
+                memcpy( out, tail, valueCount * elementSize );
+            }
+
+            minMax.Add( valueCount, gen );
+        }
+
+        OutputMinMax Finish()
+        {
+            return minMax.Finish();
+        }
+
+        uint8_t* noiseOut;
+        OutputFormat::Type type;
+        size_t elementSize;
+        float32v quantiseScale, quantiseOffset, quantiseMin, quantiseMax;
+        MinMaxAccumulator minMax;
+
+    private:
+        FS_INLINE int32v Quantise( float32v gen ) const
+        {
+            float32v scaled = FS_FMulAdd_f32( gen, quantiseScale, quantiseOffset );
+
+            return FS_Convertf32_i32( FS_Min_f32( FS_Max_f32( scaled, quantiseMin ), quantiseMax ) );
+        }
+
+        FS_INLINE void Store( void* out, float32v gen ) const
+        {
+            switch( type )
+            {
+            case OutputFormat::UInt8:
+                FS_StorePacked_u8( out, Quantise( gen ) );
+                break;
+            case OutputFormat::UInt16:
+                FS_StorePacked_u16( out, Quantise( gen ) );
+                break;
+            case OutputFormat::Int16:
+                FS_StorePacked_i16( out, Quantise( gen ) );
+                break;
+            case OutputFormat::Half:
+                FS_StorePacked_f16( out, gen );
+                break;
+            default:
+                FS_Store_f32( out, gen );
+                break;
+            }
+        }
+    };
+
+    // Writes values contiguously in the order they are generated
+    struct LinearWriter
+    {
+        explicit LinearWriter( float* out ) : noiseOut( out ) { }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            if( valueCount == FS_Size_32() )
+            {
+                FS_Store_f32( &noiseOut[index], gen );
+            }
+            else
+            {
+                FS_MaskedStore_f32( &noiseOut[index], gen, RemainingMask( valueCount ) );
+            }
+
+            minMax.Add( valueCount, gen );
+        }
+
+        OutputMinMax Finish()
+        {
+            return minMax.Finish();
+        }
+
+        float* noiseOut;
+        MinMaxAccumulator minMax;
+    };
+
+    // Writes values contiguously with non temporal stores, values arrive in index order one vector at a time
+    // When noiseOut is not vector aligned each aligned vector is built from the tail of the previous values and the head of the current ones
+    // Only the unaligned head and tail of the output use normal stores
+    struct NonTemporalWriter
+    {
+        explicit NonTemporalWriter( float* out ) :
+            noiseOut( out ),
+            peel( ( FS_Size_32() - reinterpret_cast<uintptr_t>( out ) / sizeof( float ) % FS_Size_32() ) % FS_Size_32() )
+        {
+            assert( reinterpret_cast<uintptr_t>( out ) % sizeof( float ) == 0 );
+        }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            minMax.Add( valueCount, gen );
+
+            if( peel == 0 )
+            {
+                if( valueCount == FS_Size_32() )
+                {
+                    FS_StoreNonTemporal_f32( &noiseOut[index], gen );
+                }
+                else
+                {
+                    FS_MaskedStore_f32( &noiseOut[index], gen, RemainingMask( valueCount ) );
+                }
+                return;
+            }
+
+            // carry holds the previous values followed by the current ones
+            FS_Store_f32( &carry[FS_Size_32()], gen );
+
+            if( index == 0 )
+            {
+                FS_MaskedStore_f32( noiseOut, gen, RemainingMask( std::min( peel, valueCount ) ) );
+            }
+            else if( valueCount >= peel )
+            {
+                FS_StoreNonTemporal_f32( &noiseOut[index - FS_Size_32() + peel], FS_Load_f32( &carry[peel] ) );
+            }
+            else
+            {
+                FS_MaskedStore_f32( &noiseOut[index - FS_Size_32() + peel], FS_Load_f32( &carry[peel] ), RemainingMask( FS_Size_32() - peel + valueCount ) );
+            }
+
+            if( valueCount < FS_Size_32() )
+            {
+                // Last values, nothing left to carry
+                if( valueCount > peel )
+                {
+                    FS_MaskedStore_f32( &noiseOut[index + peel], FS_Load_f32( &carry[FS_Size_32() + peel] ), RemainingMask( valueCount - peel ) );
+                }
+                carryIndex = kNoCarry;
+                return;
+            }
+
+            FS_Store_f32( carry, gen );
+            carryIndex = index;
+        }
+
+        OutputMinMax Finish()
+        {
+            if( carryIndex != kNoCarry )
+            {
+                FS_MaskedStore_f32( &noiseOut[carryIndex + peel], FS_Load_f32( &carry[peel] ), RemainingMask( FS_Size_32() - peel ) );
+            }
+
+            FS_StoreFence();
+            return minMax.Finish();
+        }
+
+        static constexpr size_t kNoCarry = ~(size_t)0;
+
+        float* noiseOut;
+        size_t peel;
+        size_t carryIndex = kNoCarry;
+        float carry[FS_Size_32() * 2];
+        MinMaxAccumulator minMax;
+    };
+
+    // Packs value > isoValue into 32 bit words using one movemask per vector
+    // Vector sizes divide 32 so a vector never spans 2 words
+    struct OccupancyWriter
+    {
+        OccupancyWriter( uint32_t* out, float iso, size_t total ) :
+            occupancyOut( out ), isoValue( iso ), totalValues( total ) { }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            uint32_t bits = FS_MoveMask_m32( FS_GreaterThan_f32( gen, isoValue ) );
+
+            if( valueCount != FS_Size_32() )
+            {
+                bits &= ( 1u << valueCount ) - 1;
+            }
+
+            word |= bits << ( index & 31 );
+
+            if( ( ( index + valueCount ) & 31 ) == 0 || index + valueCount == totalValues )
+            {
+                occupancyOut[index >> 5] = word;
+                word = 0;
+            }
+
+            minMax.Add( valueCount, gen );
+        }
+
+        OutputMinMax Finish()
+        {
+            return minMax.Finish();
+        }
+
+        uint32_t* occupancyOut;
+        float32v isoValue;
+        size_t totalValues;
+        uint32_t word = 0;
+        MinMaxAccumulator minMax;
+    };
+
+    // Counts the sorted thresholds each value is >= to and packs the counts to bytes
+    struct BandWriter
+    {
+        BandWriter( uint8_t* out, const float* thresholdsIn, int32_t count ) :
+            bandOut( out ), thresholds( thresholdsIn ), thresholdCount( count )
+        {
+            assert( thresholdCount <= 255 );
+        }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            int32v band( 0 );
+
+            for( int32_t i = 0; i < thresholdCount; i++ )
+            {
+                band = FS_MaskedIncrement_i32( band, FS_GreaterEqualThan_f32( gen, float32v( thresholds[i] ) ) );
+            }
+
+            if( valueCount == FS_Size_32() )
+            {
+                FS_StorePacked_u8( &bandOut[index], band );
+            }
+            else
+            {
+                uint8_t tail[FS_Size_32()];
+                FS_StorePacked_u8( tail, band );
+                memcpy( &bandOut[index], tail, valueCount );
+            }
+
+            minMax.Add( valueCount, gen );
+        }
+
+        OutputMinMax Finish()
+        {
+            return minMax.Finish();
+        }
+
+        uint8_t* bandOut;
+        const float* thresholds;
+        int32_t thresholdCount;
+        MinMaxAccumulator minMax;
+    };
+
+    // Accumulates the statistics requested in OutputStats::flags per lane, branches on flags are uniform for the whole call
+    // Sums are kept in float vectors relative to the first value and flushed to doubles every kFlushVectors vectors to limit rounding error
+    struct StatsWriter
+    {
+        static constexpr size_t kFlushVectors = 256;
+
+        StatsWriter( float* out, OutputStats& statsOut ) :
+            noiseOut( out ), stats( statsOut ), flags( statsOut.flags ),
+            histogramMin( statsOut.histogramMin ), histogramScale( statsOut.histogramMax > statsOut.histogramMin ? OutputStats::kHistogramBins / ( statsOut.histogramMax - statsOut.histogramMin ) : 0.0f ),
+            threshold( statsOut.threshold )
+        {
+            if( flags & OutputStats::Histogram )
+            {
+                laneHistogram.assign( FS_Size_32() * OutputStats::kHistogramBins, 0 );
+            }
+        }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            bool fullVector = valueCount == FS_Size_32();
+            mask32v valueMask = RemainingMask( valueCount );
+
+            if( noiseOut )
+            {
+                if( fullVector )
+                {
+                    FS_Store_f32( &noiseOut[index], gen );
+                }
+                else
+                {
+                    FS_MaskedStore_f32( &noiseOut[index], gen, valueMask );
+                }
+            }
+
+            if( flags & OutputStats::MinMax )
+            {
+                minMax.Add( valueCount, gen );
+            }
+
+            if( flags & OutputStats::Moments )
+            {
+                if( count == 0 )
+                {
+                    shift = float32v( FS_Extract0_f32( gen ) );
+                }
+
+                float32v delta = FS_Mask_f32( gen - shift, valueMask );
+                sum += delta;
+                sumSq = FS_FMulAdd_f32( delta, delta, sumSq );
+            }
+
+            if( flags & OutputStats::AboveThreshold )
+            {
+                // Lanes past valueCount are -inf and never above threshold
+                float32v masked = FS_Select_f32( valueMask, gen, float32v( -INFINITY ) );
+                aboveCount = FS_MaskedIncrement_i32( aboveCount, FS_GreaterThan_f32( masked, threshold ) );
+            }
+
+            if( flags & OutputStats::Histogram )
+            {
+                // Clamp in float before flooring, huge values or inf overflow the SSE2 floor and the int conversion
+                // Max with the value as its first operand also maps NaN to bin 0
+                float32v binF = FS_Max_f32( ( gen - histogramMin ) * histogramScale, float32v( 0 ) );
+                binF = FS_Min_f32( binF, float32v( OutputStats::kHistogramBins - 1 ) );
+
+                int32v bin = FS_Convertf32_i32( FS_Floor_f32( binF ) );
+
+                // One histogram per lane avoids dependent increments on the same counter
+                int32_t bins[FS_Size_32()];
+                FS_Store_i32( bins, bin );
+
+                for( size_t i = 0; i < valueCount; i++ )
+                {
+                    laneHistogram[i * OutputStats::kHistogramBins + bins[i]]++;
+                }
+            }
+
+            count += valueCount;
+
+            if( ++vectorsSinceFlush == kFlushVectors )
+            {
+                Flush();
+            }
+        }
+
+        void Finish()
+        {
+            Flush();
+
+            stats.count = count;
+            stats.minMax = OutputMinMax();
+            stats.mean = 0;
+            stats.variance = 0;
+            stats.aboveThresholdCount = 0;
+            std::fill( std::begin( stats.histogram ), std::end( stats.histogram ), 0 );
+
+            if( flags & OutputStats::MinMax )
+            {
+                stats.minMax = minMax.Finish();
+            }
+
+            if( ( flags & OutputStats::Moments ) && count )
+            {
+                double meanDelta = totalSum / count;
+                stats.mean = meanDelta + FS_Extract0_f32( shift );
+                stats.variance = std::max( 0.0, totalSumSq / count - meanDelta * meanDelta );
+            }
+
+            if( flags & OutputStats::AboveThreshold )
+            {
+                stats.aboveThresholdCount = totalAbove;
+            }
+
+            if( flags & OutputStats::Histogram )
+            {
+                for( size_t i = 0; i < laneHistogram.size(); i++ )
+                {
+                    stats.histogram[i % OutputStats::kHistogramBins] += laneHistogram[i];
+                }
+            }
+        }
+
+        float* noiseOut;
+        OutputStats& stats;
+        uint32_t flags;
+        float32v histogramMin, histogramScale, threshold;
+        MinMaxAccumulatorT<true> minMax;
+        float32v shift = float32v( 0 );
+        float32v sum = float32v( 0 );
+        float32v sumSq = float32v( 0 );
+        int32v aboveCount = int32v( 0 );
+        double totalSum = 0, totalSumSq = 0;
+        uint64_t totalAbove = 0;
+        uint64_t count = 0;
+        size_t vectorsSinceFlush = 0;
+        std::vector<uint64_t> laneHistogram;
+
+    private:
+        void Flush()
+        {
+            float sumP[FS_Size_32()], sumSqP[FS_Size_32()];
+            int32_t aboveP[FS_Size_32()];
+
+            FS_Store_f32( sumP, sum );
+            FS_Store_f32( sumSqP, sumSq );
+            FS_Store_i32( aboveP, aboveCount );
+
+            for( size_t i = 0; i < FS_Size_32(); i++ )
+            {
+                totalSum += sumP[i];
+                totalSumSq += sumSqP[i];
+                totalAbove += (uint32_t)aboveP[i];
+            }
+
+            sum = float32v( 0 );
+            sumSq = float32v( 0 );
+            aboveCount = int32v( 0 );
+            vectorsSinceFlush = 0;
+        }
+    };
+
+    // Writes values contiguously and reduces them to per brick min/max
+    // Completed rows are folded into per column min/max for their row of bricks with full vector min/max
+    // Once a brick slice completes each brick only needs a horizontal reduction over brickSize columns
+    struct BrickMinMaxWriter
+    {
+        BrickMinMaxWriter( float* out, OutputMinMax* brickOut, int32_t brickSizeIn, int32_t xSizeIn, int32_t ySizeIn, int32_t zSizeIn, int32_t brickDepthIn ) :
+            noiseOut( out ), brickMinMaxOut( brickOut ), brickSize( brickSizeIn ), brickDepth( brickDepthIn ),
+            xSize( xSizeIn ), ySize( ySizeIn ), zSize( zSizeIn ),
+            xBricks( ( xSizeIn + brickSizeIn - 1 ) / brickSizeIn ), yBricks( ( ySizeIn + brickSizeIn - 1 ) / brickSizeIn ),
+            columnStride( ( xSizeIn + FS_Size_32() - 1 ) / FS_Size_32() * FS_Size_32() )
+        {
+            assert( brickSize > 0 );
+
+            columnMin.assign( columnStride * yBricks, INFINITY );
+            columnMax.assign( columnStride * yBricks, -INFINITY );
+        }
+
+        FS_INLINE void Write( size_t index, size_t valueCount, float32v gen )
+        {
+            if( valueCount == FS_Size_32() )
+            {
+                FS_Store_f32( &noiseOut[index], gen );
+            }
+            else
+            {
+                FS_MaskedStore_f32( &noiseOut[index], gen, RemainingMask( valueCount ) );
+            }
+
+            minMax.Add( valueCount, gen );
+
+            x += (int32_t)valueCount;
+
+            while( x >= xSize )
+            {
+                x -= xSize;
+                FoldRow();
+            }
+        }
+
+        OutputMinMax Finish()
+        {
+            return minMax.Finish();
+        }
+
+        float* noiseOut;
+        OutputMinMax* brickMinMaxOut;
+        int32_t brickSize, brickDepth;
+        int32_t xSize, ySize, zSize;
+        size_t xBricks, yBricks;
+        size_t columnStride;
+        std::vector<float> columnMin, columnMax;
+        int32_t x = 0, y = 0, z = 0;
+        size_t rowStart = 0;
+        size_t brickLayer = 0;
+        MinMaxAccumulator minMax;
+
+    private:
+        void FoldRow()
+        {
+            const float* row = &noiseOut[rowStart];
+            size_t column = ( y / brickSize ) * columnStride;
+
+            for( int32_t i = 0; i < xSize; i += (int32_t)FS_Size_32() )
+            {
+                // Columns are padded to a whole vector, padding is never reduced
+                float32v value = LoadRemaining( &row[i], xSize - i );
+
+                FS_Store_f32( &columnMin[column + i], FS_Min_f32( FS_Load_f32( &columnMin[column + i] ), value ) );
+                FS_Store_f32( &columnMax[column + i], FS_Max_f32( FS_Load_f32( &columnMax[column + i] ), value ) );
+            }
+
+            rowStart += xSize;
+
+            if( ++y == ySize )
+            {
+                y = 0;
+                z++;
+
+                if( z % brickDepth == 0 || z == zSize )
+                {
+                    FlushBricks();
+                }
+            }
+        }
+
+        void FlushBricks()
+        {
+            for( size_t by = 0; by < yBricks; by++ )
+            {
+                float* colMin = &columnMin[by * columnStride];
+                float* colMax = &columnMax[by * columnStride];
+
+                for( size_t bx = 0; bx < xBricks; bx++ )
+                {
+                    OutputMinMax& brick = brickMinMaxOut[( brickLayer * yBricks + by ) * xBricks + bx];
+                    brick = OutputMinMax();
+
+                    for( size_t i = bx * brickSize; i < std::min<size_t>( ( bx + 1 ) * brickSize, xSize ); i++ )
+                    {
+                        brick << OutputMinMax{ colMin[i], colMax[i] };
+                    }
+                }
+
+                std::fill( colMin, colMin + columnStride, INFINITY );
+                std::fill( colMax, colMax + columnStride, -INFINITY );
+            }
+
+            brickLayer++;
+        }
+    };
+
+    // Collects bricked output one brick at a time and hands each finished brick to a SparseVolume
+    // Only one brick of dense values is held here, uniform bricks never reach dense storage
+    struct SparseBrickWriter
+    {
+        SparseBrickWriter( SparseVolume& volumeOut, int32_t brickSize, float iso, float toleranceIn ) :
+            volume( volumeOut ), brickVolume( (size_t)brickSize * brickSize * brickSize ), isoValue( iso ), tolerance( toleranceIn ) { }
+
+        FS_INLINE void Write( size_t index, size_t, float32v gen )
+        {
+            // Brick volume is a multiple of the vector size, vectors are always full
+            size_t local = index & ( brickVolume - 1 );
+
+            FS_Store_f32( &brickValues[local], gen );
+
+            brickMin = local == 0 ? gen : FS_Min_f32( brickMin, gen );
+            brickMax = local == 0 ? gen : FS_Max_f32( brickMax, gen );
+
+            if( local + FS_Size_32() == brickVolume )
+            {
+                FinishBrick();
+            }
+        }
+
+        SparseVolume& volume;
+        size_t brickVolume;
+        float isoValue;
+        float tolerance;
+        OutputMinMax minMax;
+
+    private:
+        void FinishBrick()
+        {
+            OutputMinMax brickMinMax;
+            float* minP = reinterpret_cast<float*>( &brickMin );
+            float* maxP = reinterpret_cast<float*>( &brickMax );
+
+            for( size_t i = 0; i < FS_Size_32(); i++ )
+            {
+                brickMinMax << OutputMinMax{ minP[i], maxP[i] };
+            }
+
+            minMax << brickMinMax;
+
+            if( brickMinMax.max - brickMinMax.min <= tolerance || brickMinMax.min > isoValue || brickMinMax.max <= isoValue )
+            {
+                // Midpoint is on the same side of the iso value as the whole brick
+                volume.AddUniformBrick( ( brickMinMax.min + brickMinMax.max ) * 0.5f );
+            }
+            else
+            {
+                volume.AddDenseBrick( brickValues );
+            }
+        }
+
+        float brickValues[8 * 8 * 8];
+        float32v brickMin, brickMax;
+    };
+
+    // Writes grid values into a larger buffer, consecutive rows are rowPitch floats apart and slices slicePitch floats apart
+    // Vectors are written in grid order, so the output position is tracked incrementally instead of divided out of the index
+    struct PitchedWriter
+    {
+        PitchedWriter( float* out, size_t rowPitchIn, size_t slicePitchIn, int32_t xSizeIn, int32_t ySizeIn ) :
+            noiseOut( out ), rowPitch( rowPitchIn ), slicePitch( slicePitchIn ), xSize( xSizeIn ), ySize( ySizeIn ) { }
+
+        FS_INLINE void Write( size_t, size_t valueCount, float32v gen )
+        {
+            if( x + (int32_t)valueCount <= xSize )
+            {
+                if( valueCount == FS_Size_32() )
+                {
+                    FS_Store_f32( &noiseOut[rowOffset + x], gen );
+                }
+                else
+                {
+                    FS_MaskedStore_f32( &noiseOut[rowOffset + x], gen, RemainingMask( valueCount ) );
+                }
+                Advance( (int32_t)valueCount );
+            }
+            else
+            {
+                // Vector wraps onto the following rows, each row gets one masked store of the lanes that land in it
+                // Lane i of the vector is stored at base + i, so the base is offset back by the lanes already written
+                size_t lane = 0;
+
+                while( lane < valueCount )
+                {
+                    size_t rowValues = std::min<size_t>( valueCount - lane, (size_t)( xSize - x ) );
+                    mask32v rowMask = FS_BitwiseAndNot_m32( RemainingMask( lane + rowValues ), RemainingMask( lane ) );
+
+                    FS_MaskedStore_f32( &noiseOut[rowOffset + x - lane], gen, rowMask );
+
+                    lane += rowValues;
+                    Advance( (int32_t)rowValues );
+                }
+            }
+
+            minMax.Add( valueCount, gen );
+        }
+
+        OutputMinMax Finish()
+        {
+            return minMax.Finish();
+        }
+
+        float* noiseOut;
+        size_t rowPitch;
+        size_t slicePitch;
+        int32_t xSize;
+        int32_t ySize;
+        int32_t x = 0;
+        int32_t y = 0;
+        int32_t z = 0;
+        size_t rowOffset = 0;
+        MinMaxAccumulator minMax;
+
+    private:
+        FS_INLINE void Advance( int32_t count )
+        {
+            x += count;
+
+            if( x >= xSize )
+            {
+                x -= xSize;
+
+                if( ++y == ySize )
+                {
+                    y = 0;
+                    z++;
+                }
+                rowOffset = y * rowPitch + z * slicePitch;
+            }
+        }
+    };
+
+    // Grid coordinates of each lane while stepping through a grid one vector at a time in x, y, z order
+    // The vector step is split into whole slices, rows and columns so each axis carries at most once per step,
+    // this lets a vector span several rows when rows are shorter than the vector size
+    struct GridCursor
+    {
+        // ySize 0 leaves y unbounded, used for 2D grids
+        GridCursor( int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize = 0 ) :
+            x( int32v( xStart ) + int32v::FS_Incremented() ), y( yStart ), z( zStart ),
+            xSizeV( xSize ), ySizeV( ySize ),
+            xMax( xStart + xSize - 1 ), yMax( yStart + ySize - 1 ),
+            xStep( 0 ), yStep( 0 ), zStep( 0 )
+        {
+            // Empty grids generate nothing
+            if( xSize <= 0 || ySize < 0 )
+            {
+                return;
+            }
+
+            int64_t vectorSize = FS_Size_32();
+            int64_t sliceSize = (int64_t)xSize * ySize;
+
+            xStep = int32v( (int32_t)( vectorSize % xSize ) );
+            yStep = int32v( (int32_t)( ySize ? vectorSize / xSize % ySize : vectorSize / xSize ) );
+            zStep = int32v( (int32_t)( ySize ? vectorSize / sliceSize : 0 ) );
+
+            // Lanes of the first vector may already span several rows or slices
+            for( int64_t i = xSize; i < vectorSize; i += xSize )
+            {
+                CarryX();
+            }
+            for( int64_t i = sliceSize; ySize && i < vectorSize; i += sliceSize )
+            {
+                CarryY();
+            }
+        }
+
+        FS_INLINE void Advance2D()
+        {
+            x += xStep;
+            y += yStep;
+            CarryX();
+        }
+
+        FS_INLINE void Advance3D()
+        {
+            x += xStep;
+            y += yStep;
+            z += zStep;
+            CarryX();
+            CarryY();
+        }
+
+        int32v x, y, z;
+
+    private:
+        FS_INLINE void CarryX()
+        {
+            mask32v xReset = FS_GreaterThan_i32( x, xMax );
+            y = FS_MaskedIncrement_i32( y, xReset );
+            x = FS_MaskedSub_i32( x, xSizeV, xReset );
+        }
+
+        FS_INLINE void CarryY()
+        {
+            mask32v yReset = FS_GreaterThan_i32( y, yMax );
+            z = FS_MaskedIncrement_i32( z, yReset );
+            y = FS_MaskedSub_i32( y, ySizeV, yReset );
+        }
+
+        int32v xSizeV, ySizeV;
+        int32v xMax, yMax;
+        int32v xStep, yStep, zStep;
+    };
+
+    // Walks a grid one vector at a time calling visit( index, valueCount, x, y ) with the grid coordinates of each vector
+    template<typename Visit>
+    static FS_INLINE void IterateGrid2D( int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, Visit&& visit )
+    {
+        GridCursor cursor( xStart, yStart, 0, xSize );
+
+        size_t totalValues = (size_t)xSize * ySize;
+
+        for( size_t index = 0; index < totalValues; index += FS_Size_32() )
+        {
+            visit( index, std::min<size_t>( totalValues - index, FS_Size_32() ), cursor.x, cursor.y );
+
+            cursor.Advance2D();
+        }
+    }
+
+    template<typename Visit>
+    static FS_INLINE void IterateGrid3D( int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, Visit&& visit )
+    {
+        GridCursor cursor( xStart, yStart, zStart, xSize, ySize );
+
+        size_t totalValues = (size_t)xSize * ySize * zSize;
+
+        for( size_t index = 0; index < totalValues; index += FS_Size_32() )
+        {
+            visit( index, std::min<size_t>( totalValues - index, FS_Size_32() ), cursor.x, cursor.y, cursor.z );
+
+            cursor.Advance3D();
+        }
+    }
+
+    // Generates a uniform grid one vector at a time, handing each vector to writer.Write( index, valueCount, gen )
+    template<typename Writer>
+    FS_INLINE void IterateUniformGrid2D( Writer& writer, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed ) const
+    {
+        float32v freqV( frequency );
+
+        IterateGrid2D( xStart, yStart, xSize, ySize, [&]( size_t index, size_t valueCount, int32v x, int32v y )
+        {
+            writer.Write( index, valueCount, Gen( int32v( seed ), FS_Converti32_f32( x ) * freqV, FS_Converti32_f32( y ) * freqV ) );
+        } );
+    }
+
+    template<typename Writer>
+    FS_INLINE void IterateUniformGrid3D( Writer& writer, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const
+    {
+        float32v freqV( frequency );
+
+        IterateGrid3D( xStart, yStart, zStart, xSize, ySize, zSize, [&]( size_t index, size_t valueCount, int32v x, int32v y, int32v z )
+        {
+            writer.Write( index, valueCount, Gen( int32v( seed ), FS_Converti32_f32( x ) * freqV, FS_Converti32_f32( y ) * freqV, FS_Converti32_f32( z ) * freqV ) );
+        } );
+    }
+
+    // Generates a 3D grid in the element order of layout, grid coordinates of each output vector are derived from its index
+    template<typename Writer>
+    FS_INLINE void IterateUniformGrid3D( Writer& writer, GridLayout3D layout, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed ) const
+    {
+        size_t totalValues = (size_t)xSize * ySize * zSize;
+
+        switch( layout )
+        {
+        case GridLayout3D::LinearZYX:
+        {
+            // Cursor axes are swapped, z is its fastest axis
+            GridCursor cursor( 0, 0, 0, zSize, ySize );
+
+            IterateGridCoords( writer, totalValues, xStart, yStart, zStart, frequency, seed, [&]( size_t, int32v& x, int32v& y, int32v& z )
+            {
+                x = cursor.z;
+                y = cursor.y;
+                z = cursor.x;
+
+                cursor.Advance3D();
+            } );
+            break;
+        }
+        case GridLayout3D::Bricked4:
+        case GridLayout3D::Bricked8:
+        {
+            // Brick volume is a multiple of the vector size so a vector never spans 2 bricks
+            int32_t brickShift = layout == GridLayout3D::Bricked4 ? 2 : 3;
+            int32_t brickMask = ( 1 << brickShift ) - 1;
+
+            assert( ( xSize & brickMask ) == 0 && ( ySize & brickMask ) == 0 && ( zSize & brickMask ) == 0 );
+
+            size_t xBricks = (size_t)xSize >> brickShift;
+            size_t yBricks = (size_t)ySize >> brickShift;
+            int32v localMask( brickMask );
+
+            IterateGridCoords( writer, totalValues, xStart, yStart, zStart, frequency, seed, [&]( size_t index, int32v& x, int32v& y, int32v& z )
+            {
+                size_t brick = index >> ( brickShift * 3 );
+                int32v local = int32v( (int32_t)( index & ( ( (size_t)1 << ( brickShift * 3 ) ) - 1 ) ) ) + int32v::FS_Incremented();
+
+                x = int32v( (int32_t)( brick % xBricks ) << brickShift ) + ( local & localMask );
+                y = int32v( (int32_t)( brick / xBricks % yBricks ) << brickShift ) + ( ( local >> brickShift ) & localMask );
+                z = int32v( (int32_t)( brick / ( xBricks * yBricks ) ) << brickShift ) + ( local >> ( brickShift * 2 ) );
+            } );
+            break;
+        }
+        case GridLayout3D::Morton:
+        {
+            assert( xSize == ySize && ySize == zSize && ( xSize & ( xSize - 1 ) ) == 0 && xSize <= 1024 );
+
+            IterateGridCoords( writer, totalValues, xStart, yStart, zStart, frequency, seed, [&]( size_t index, int32v& x, int32v& y, int32v& z )
+            {
+                int32v code = int32v( (int32_t)index ) + int32v::FS_Incremented();
+
+                x = MortonCompact( code );
+                y = MortonCompact( code >> 1 );
+                z = MortonCompact( code >> 2 );
+            } );
+            break;
+        }
+        default:
+            IterateUniformGrid3D( writer, xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+            break;
+        }
+    }
+
+private:
+    // Generates one vector per step at the grid coordinates from coords( index, x, y, z ), coordinates are relative to the grid start
+    template<typename Writer, typename Coords>
+    FS_INLINE void IterateGridCoords( Writer& writer, size_t totalValues, int32_t xStart, int32_t yStart, int32_t zStart, float frequency, int32_t seed, Coords&& coords ) const
+    {
+        float32v freqV( frequency );
+
+        for( size_t index = 0; index < totalValues; index += FS_Size_32() )
+        {
+            int32v xIdx, yIdx, zIdx;
+            coords( index, xIdx, yIdx, zIdx );
+
+            float32v xPos = FS_Converti32_f32( xIdx + int32v( xStart ) ) * freqV;
+            float32v yPos = FS_Converti32_f32( yIdx + int32v( yStart ) ) * freqV;
+            float32v zPos = FS_Converti32_f32( zIdx + int32v( zStart ) ) * freqV;
+
+            writer.Write( index, std::min<size_t>( totalValues - index, FS_Size_32() ), Gen( int32v( seed ), xPos, yPos, zPos ) );
+        }
+    }
+
+    // Gathers every third bit of a Morton code into the low bits
+    static FS_INLINE int32v MortonCompact( int32v code )
+    {
+        code &= int32v( 0x09249249 );
+        code = ( code ^ ( code >> 2 ) ) & int32v( 0x030C30C3 );
+        code = ( code ^ ( code >> 4 ) ) & int32v( 0x0300F00F );
+        code = ( code ^ ( code >> 8 ) ) & int32v( 0x030000FF );
+        code = ( code ^ ( code >> 16 ) ) & int32v( 0x000003FF );
+        return code;
+    }
+
+    // Packs the final partial vector of interleaved positions, a strided load there could read far past the end of the buffer
+    static void CopyInterleavedTail( float* tail, size_t dimensions, const char* positionBytes, size_t byteStride, int32_t index, int32_t count )
+    {
+        std::fill( tail, tail + FS_Size_32() * dimensions, 0.0f );
+
+        for( int32_t i = index; i < count; i++ )
+        {
+            memcpy( &tail[( i - index ) * dimensions], positionBytes + i * byteStride, sizeof( float ) * dimensions );
+        }
+    }
+
+    // One axis of an affine grid position, computed from the grid indices so steps don't accumulate float error
+    static FS_INLINE float32v AffinePos( float32v origin, float32v xStep, float32v yStep, float32v xf, float32v yf )
+    {
+        return FS_FMulAdd_f32( xf, xStep, FS_FMulAdd_f32( yf, yStep, origin ) );
+    }
+
+    static FS_INLINE float32v AffinePos( float32v origin, float32v xStep, float32v yStep, float32v zStep, float32v xf, float32v yf, float32v zf )
+    {
+        return FS_FMulAdd_f32( xf, xStep, FS_FMulAdd_f32( yf, yStep, FS_FMulAdd_f32( zf, zStep, origin ) ) );
+    }
+
+    // Normalises the cube surface point and scales it onto the sphere, exact sqrt keeps face borders matching
+    static FS_INLINE void ProjectToSphere( float32v scale, float32v& x, float32v& y, float32v& z )
+    {
+        float32v lengthSq = FS_FMulAdd_f32( x, x, FS_FMulAdd_f32( y, y, z * z ) );
+        float32v invLength = scale / FS_Sqrt_f32( lengthSq );
+
+        x *= invLength;
+        y *= invLength;
+        z *= invLength;
+    }
+
+    template<typename... O>
+    static void SetNextPositionOffset( O... offset )
+    {
+        size_t idx = 0;
+        ((sNextPositionOffset.v[idx++] = offset), ...);
+        sNextPositionOffset.active = true;
+    }
+
+    static FS_INLINE OutputMinMax DoRemaining( float* noiseOut, size_t totalValues, size_t index, float32v min, float32v max, float32v finalGen )
+    {
+        OutputMinMax minMax;
+        mask32v remainingMask = RemainingMask( totalValues - index );
+
+        FS_MaskedStore_f32( &noiseOut[index], finalGen, remainingMask );
+
+#if FASTNOISE_CALC_MIN_MAX
+        min = FS_Select_f32( remainingMask, FS_Min_f32( min, finalGen ), min );
+        max = FS_Select_f32( remainingMask, FS_Max_f32( max, finalGen ), max );
+
         float* minP = reinterpret_cast<float*>(&min);
         float* maxP = reinterpret_cast<float*>(&max);
         for( size_t i = 0; i < FS_Size_32(); i++ )
@@ -1,4 +1,7 @@
 #pragma once
+#include <utility>
+#include <vector>
+
 #include "Generator.h"
 
 namespace FastNoise
@@ -207,4 +210,46 @@ namespace FastNoise
             }
         };    
     };
+
+    // Remaps source through a curve baked into a lookup table
+    // Points are "x y" pairs, source values outside the curve are clamped to the end points
+    class Curve : public virtual Generator
+    {
+    public:
+        enum class Interpolation
+        {
+            Linear,
+            Cubic,
+        };
+
+        Curve() { SetPoints( "-1 -1, 1 1" ); }
+
+        void SetSource( SmartNodeArg<> gen ) { this->SetSourceMemberVariable( mSource, gen ); }
+        void SetInterpolation( Interpolation value ) { mInterpolation = value; BakeTable(); }
+        bool SetPoints( const char* points );
+        bool SetPoints( const std::vector<std::pair<float, float>>& points );
+
+        static const int kTableSize = 256;
+
+    protected:
+        void BakeTable();
+
+        GeneratorSource mSource;
+        Interpolation mInterpolation = Interpolation::Linear;
+        std::vector<std::pair<float, float>> mPoints;
+        float mDomainMin = -1.0f;
+        float mDomainScale = kTableSize / 2.0f;
+        alignas( 64 ) float mTable[kTableSize + 1];
+
+        FASTNOISE_METADATA( Generator )
+        
+            Metadata( const char* className ) : Generator::Metadata( className )
+            {
+                groups.push_back( "Modifiers" );
+                this->AddGeneratorSource( "Source", &Curve::SetSource );
+                this->AddVariableEnum( "Interpolation", Interpolation::Linear, &Curve::SetInterpolation, "Linear", "Cubic" );
+                this->AddStringVariable( "Points", "-1 -1, 1 1", &Curve::SetPoints );
+            }
+        };    
+    };
 }
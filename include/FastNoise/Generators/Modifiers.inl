@@ -11,6 +11,9 @@ public:
     template<typename... P> 
     FS_INLINE float32v GenT( int32v seed, P... pos ) const
     {
+        PositionOffsetScope offsetScope;
+        offsetScope.Scale( mScale );
+
         return this->GetSourceValue( mSource, seed, (pos * float32v( mScale ))... );
     }
 };
@@ -42,6 +45,17 @@ public:
     {
         if( mPitchSin == 0.0f && mRollSin == 0.0f )
         {
+            PositionOffsetScope offsetScope;
+
+            if( offsetScope.Active() )
+            {
+                double* offset = offsetScope.Offset();
+                double x0 = offset[0];
+
+                offset[0] = x0 * mYawCos - offset[1] * mYawSin;
+                offset[1] = x0 * mYawSin + offset[1] * mYawCos;
+            }
+
             return this->GetSourceValue( mSource, seed,
                 FS_FNMulAdd_f32( y, float32v( mYawSin ), x * float32v( mYawCos ) ),
                 FS_FMulAdd_f32( x, float32v( mYawSin ), y * float32v( mYawCos ) ) );
@@ -52,6 +66,18 @@ public:
 
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z ) const final
     {
+        PositionOffsetScope offsetScope;
+
+        if( offsetScope.Active() )
+        {
+            double* offset = offsetScope.Offset();
+            double x0 = offset[0], y0 = offset[1], z0 = offset[2];
+
+            offset[0] = x0 * mXa + y0 * mXb + z0 * mXc;
+            offset[1] = x0 * mYa + y0 * mYb + z0 * mYc;
+            offset[2] = x0 * mZa + y0 * mZb + z0 * mZc;
+        }
+
         return this->GetSourceValue( mSource, seed,
             FS_FMulAdd_f32( x, float32v( mXa ), FS_FMulAdd_f32( y, float32v( mXb ), z * float32v( mXc ) ) ),
             FS_FMulAdd_f32( x, float32v( mYa ), FS_FMulAdd_f32( y, float32v( mYb ), z * float32v( mYc ) ) ),
@@ -115,3 +141,26 @@ public:
     }
 };
 
+template<typename FS>
+class FS_T<FastNoise::Curve, FS> : public virtual FastNoise::Curve, public FS_T<FastNoise::Generator, FS>
+{
+public:
+    FASTNOISE_IMPL_GEN_T;
+
+    template<typename... P>
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        float32v source = this->GetSourceValue( mSource, seed, pos... );
+
+        float32v tablePos = ( source - float32v( mDomainMin ) ) * float32v( mDomainScale );
+        tablePos = FS_Min_f32( FS_Max_f32( tablePos, float32v( 0 ) ), float32v( (float)kTableSize ) );
+
+        float32v tableFloor = FS_Min_f32( FS_Floor_f32( tablePos ), float32v( (float)(kTableSize - 1) ) );
+        int32v tableIdx = FS_Convertf32_i32( tableFloor );
+
+        float32v v0 = FS_Gather_f32( mTable, tableIdx );
+        float32v v1 = FS_Gather_f32( mTable + 1, tableIdx );
+
+        return FS_FMulAdd_f32( v1 - v0, tablePos - tableFloor, v0 );
+    }
+};
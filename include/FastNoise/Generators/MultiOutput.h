@@ -0,0 +1,70 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "Generator.h"
+
+namespace FastNoise
+{
+    // Node tree with several named outputs generated in a single traversal of the positions
+    // Nodes referenced by more than one parent, such as a base fractal used by several outputs, are generated once per sample
+    // Trees loaded from an encoded node tree share identical subtrees, so repeated subtrees there are generated once as well
+    // When used as a normal generator the first output is returned
+    class MultiOutput : public virtual Generator
+    {
+    public:
+        void SetOutputCount( size_t count ) { mOutputs.resize( count ); }
+        void SetOutput( size_t index, SmartNodeArg<> gen ) { this->SetSourceMemberVariable( mOutputs.at( index ), gen ); }
+        void SetOutput( size_t index, float value ) { mOutputs.at( index ) = value; }
+        size_t GetOutputCount() const { return mOutputs.size(); }
+
+        // Comma separated, outputs without a name can still be accessed by index
+        bool SetOutputNames( const char* names );
+        const std::vector<std::string>& GetOutputNames() const { return mOutputNames; }
+
+        // Returns -1 if no output matches name
+        int GetOutputIndex( const char* name ) const;
+
+        // noiseOuts holds one pointer per output, elementStride is the distance in floats between consecutive values of an output
+        // Planar: noiseOuts = { heightBuffer, moistureBuffer }, elementStride = 1
+        // Interleaved: noiseOuts = { buffer + 0, buffer + 1 }, elementStride = 2
+        // minMaxOut is optional and is overwritten with one OutputMinMax per output
+
+        virtual void GenUniformGrid2D( float* const* noiseOuts, size_t elementStride,
+            int32_t xStart, int32_t yStart,
+            int32_t xSize, int32_t ySize,
+            float frequency, int32_t seed, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        virtual void GenUniformGrid3D( float* const* noiseOuts, size_t elementStride,
+            int32_t xStart, int32_t yStart, int32_t zStart,
+            int32_t xSize,  int32_t ySize,  int32_t zSize,
+            float frequency, int32_t seed, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        virtual void GenPositionArray2D( float* const* noiseOuts, size_t elementStride, int32_t count,
+            const float* xPosArray, const float* yPosArray,
+            float xOffset, float yOffset, int32_t seed, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        virtual void GenPositionArray3D( float* const* noiseOuts, size_t elementStride, int32_t count,
+            const float* xPosArray, const float* yPosArray, const float* zPosArray,
+            float xOffset, float yOffset, float zOffset, int32_t seed, OutputMinMax* minMaxOut = nullptr ) const = 0;
+
+        using Generator::GenUniformGrid2D;
+        using Generator::GenUniformGrid3D;
+        using Generator::GenPositionArray2D;
+        using Generator::GenPositionArray3D;
+
+    protected:
+        std::vector<HybridSource> mOutputs = std::vector<HybridSource>( 2 );
+        std::vector<std::string> mOutputNames;
+
+        FASTNOISE_METADATA( Generator )
+
+            Metadata( const char* className ) : Generator::Metadata( className )
+            {
+                groups.push_back( "Modifiers" );
+                this->AddHybridSourceList( "Output", 0.0f, &MultiOutput::SetOutputCount, &MultiOutput::SetOutput, &MultiOutput::SetOutput );
+                this->AddStringVariable( "Output Names", "", &MultiOutput::SetOutputNames );
+            }
+        };
+    };
+}
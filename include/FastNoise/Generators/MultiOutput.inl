@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <cassert>
+#include "FastSIMD/InlInclude.h"
+
+#include "MultiOutput.h"
+
+template<typename FS>
+class FS_T<FastNoise::MultiOutput, FS> : public virtual FastNoise::MultiOutput, public FS_T<FastNoise::Generator, FS>
+{
+    using MultiOutputWriter = typename FS_T<FastNoise::Generator, FS>::MultiOutputWriter;
+    using SharedValueCache = typename FS_T<FastNoise::Generator, FS>::SharedValueCache;
+    using SharedValueScope = typename FS_T<FastNoise::Generator, FS>::SharedValueScope;
+
+public:
+    FASTNOISE_IMPL_GEN_T;
+
+    template<typename... P>
+    FS_INLINE float32v GenT( int32v seed, P... pos ) const
+    {
+        if( mOutputs.empty() )
+        {
+            return float32v( 0 );
+        }
+        return this->GetSourceValue( mOutputs[0], seed, pos... );
+    }
+
+    using FS_T<FastNoise::Generator, FS>::GenUniformGrid2D;
+    using FS_T<FastNoise::Generator, FS>::GenUniformGrid3D;
+    using FS_T<FastNoise::Generator, FS>::GenPositionArray2D;
+    using FS_T<FastNoise::Generator, FS>::GenPositionArray3D;
+
+    void GenUniformGrid2D( float* const* noiseOuts, size_t elementStride, int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed, FastNoise::OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( mOutputs.size(), noiseOuts, elementStride, minMaxOut );
+        SharedValueCache sharedValues;
+        SharedValueScope sharedValueScope( sharedValues );
+
+        float32v freqV( frequency );
+
+        this->IterateGrid2D( xStart, yStart, xSize, ySize, [&]( size_t index, size_t valueCount, int32v x, int32v y )
+        {
+            GenOutputs( writer, sharedValues, index, valueCount, int32v( seed ), FS_Converti32_f32( x ) * freqV, FS_Converti32_f32( y ) * freqV );
+        } );
+
+        writer.Finish();
+    }
+
+    void GenUniformGrid3D( float* const* noiseOuts, size_t elementStride, int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed, FastNoise::OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( mOutputs.size(), noiseOuts, elementStride, minMaxOut );
+        SharedValueCache sharedValues;
+        SharedValueScope sharedValueScope( sharedValues );
+
+        float32v freqV( frequency );
+
+        this->IterateGrid3D( xStart, yStart, zStart, xSize, ySize, zSize, [&]( size_t index, size_t valueCount, int32v x, int32v y, int32v z )
+        {
+            GenOutputs( writer, sharedValues, index, valueCount, int32v( seed ), FS_Converti32_f32( x ) * freqV, FS_Converti32_f32( y ) * freqV, FS_Converti32_f32( z ) * freqV );
+        } );
+
+        writer.Finish();
+    }
+
+    void GenPositionArray2D( float* const* noiseOuts, size_t elementStride, int32_t count, const float* xPosArray, const float* yPosArray, float xOffset, float yOffset, int32_t seed, FastNoise::OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( mOutputs.size(), noiseOuts, elementStride, minMaxOut );
+        SharedValueCache sharedValues;
+        SharedValueScope sharedValueScope( sharedValues );
+
+        size_t index = 0;
+        while( index < (size_t)count )
+        {
+            float32v xPos = float32v( xOffset ) + this->LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + this->LoadRemaining( &yPosArray[index], count - index );
+
+            GenOutputs( writer, sharedValues, index, std::min<size_t>( count - index, FS_Size_32() ), int32v( seed ), xPos, yPos );
+
+            index += FS_Size_32();
+        }
+
+        writer.Finish();
+    }
+
+    void GenPositionArray3D( float* const* noiseOuts, size_t elementStride, int32_t count, const float* xPosArray, const float* yPosArray, const float* zPosArray, float xOffset, float yOffset, float zOffset, int32_t seed, FastNoise::OutputMinMax* minMaxOut ) const final
+    {
+        GenerationScope generationScope;
+
+        MultiOutputWriter writer( mOutputs.size(), noiseOuts, elementStride, minMaxOut );
+        SharedValueCache sharedValues;
+        SharedValueScope sharedValueScope( sharedValues );
+
+        size_t index = 0;
+        while( index < (size_t)count )
+        {
+            float32v xPos = float32v( xOffset ) + this->LoadRemaining( &xPosArray[index], count - index );
+            float32v yPos = float32v( yOffset ) + this->LoadRemaining( &yPosArray[index], count - index );
+            float32v zPos = float32v( zOffset ) + this->LoadRemaining( &zPosArray[index], count - index );
+
+            GenOutputs( writer, sharedValues, index, std::min<size_t>( count - index, FS_Size_32() ), int32v( seed ), xPos, yPos, zPos );
+
+            index += FS_Size_32();
+        }
+
+        writer.Finish();
+    }
+
+private:
+    // Evaluates every output for one vector of positions, nodes with more than one parent are only generated once per vector
+    template<typename... P>
+    FS_INLINE void GenOutputs( MultiOutputWriter& writer, SharedValueCache& sharedValues, size_t index, size_t valueCount, int32v seed, P... pos ) const
+    {
+        sharedValues.Reset();
+
+        for( size_t i = 0; i < mOutputs.size(); i++ )
+        {
+            writer.Write( i, index, valueCount, this->GetSourceValue( mOutputs[i], seed, pos... ) );
+        }
+    }
+};
@@ -3,6 +3,47 @@
 #include "Simplex.h"
 #include "CoherentHelpers.inl"
 
+// Applies the simplex skew to the large world offset: scale * offset + skew * sum( offset ), returns nullptr if there is no offset
+inline const double* SkewPositionOffset( const double* offset, size_t dims, double scale, double skew, double* skewedOut )
+{
+    if( !offset )
+    {
+        return nullptr;
+    }
+
+    double sum = 0;
+    for( size_t i = 0; i < dims; i++ )
+    {
+        sum += offset[i];
+    }
+    for( size_t i = 0; i < dims; i++ )
+    {
+        skewedOut[i] = scale * offset[i] + skew * sum;
+    }
+    return skewedOut;
+}
+
+// 2D simplex unskews using the lattice cell, so the unskewed position of the offset's whole cells is also needed
+// unskewedOut receives offset - unskew( whole cells ), which stays small
+inline LatticeOffset SplitSimplexLatticeOffset2D( const double* offset, double F2, double G2, float* unskewedOut )
+{
+    double skewed[2];
+    LatticeOffset lattice = SplitLatticeOffset( SkewPositionOffset( offset, 2, 1.0, F2, skewed ), 2 );
+
+    unskewedOut[0] = unskewedOut[1] = 0;
+
+    if( offset )
+    {
+        double i = std::floor( skewed[0] );
+        double j = std::floor( skewed[1] );
+        double g = G2 * (i + j);
+
+        unskewedOut[0] = (float)( offset[0] - (i - g) );
+        unskewedOut[1] = (float)( offset[1] - (j - g) );
+    }
+    return lattice;
+}
+
 template<typename FS>
 class FS_T<FastNoise::Simplex, FS> : public virtual FastNoise::Simplex, public FS_T<FastNoise::Generator, FS>
 {
@@ -12,16 +53,19 @@ class FS_T<FastNoise::Simplex, FS> : public virtual FastNoise::Simplex, public F
         const float F2 = 0.5f * (SQRT3 - 1.0f);
         const float G2 = (3.0f - SQRT3) / 6.0f;
 
+        float unskewedOffset[2];
+        LatticeOffset offset = SplitSimplexLatticeOffset2D( GetPositionOffset(), F2, G2, unskewedOffset );
+
         float32v f = float32v( F2 ) * (x + y);
-        float32v x0 = FS_Floor_f32( x + f );
-        float32v y0 = FS_Floor_f32( y + f );
+        float32v x0 = FS_Floor_f32( x + f + float32v( offset.fraction[0] ) );
+        float32v y0 = FS_Floor_f32( y + f + float32v( offset.fraction[1] ) );
 
-        int32v i = FS_Convertf32_i32( x0 ) * int32v( Primes::X );
-        int32v j = FS_Convertf32_i32( y0 ) * int32v( Primes::Y );
+        int32v i = FS_Convertf32_i32( x0 ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v j = FS_Convertf32_i32( y0 ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
 
         float32v g = float32v( G2 ) * (x0 + y0);
-        x0 = x - (x0 - g);
-        y0 = y - (y0 - g);
+        x0 = x + float32v( unskewedOffset[0] ) - (x0 - g);
+        y0 = y + float32v( unskewedOffset[1] ) - (y0 - g);
 
         mask32v i1 = FS_GreaterThan_f32( x0, y0 );
         //mask32v j1 = ~i1; //NMasked funcs
@@ -61,6 +105,9 @@ class FS_T<FastNoise::Simplex, FS> : public virtual FastNoise::Simplex, public F
         y += f;
         z += f;
 
+        double skewedOffset[3];
+        LatticeOffset offset = ApplyLatticeOffset( SkewPositionOffset( GetPositionOffset(), 3, 1.0, F3, skewedOffset ), x, y, z );
+
         float32v x0 = FS_Floor_f32( x );
         float32v y0 = FS_Floor_f32( y );
         float32v z0 = FS_Floor_f32( z );
@@ -68,9 +115,9 @@ class FS_T<FastNoise::Simplex, FS> : public virtual FastNoise::Simplex, public F
         float32v yi = y - y0;
         float32v zi = z - z0;
 
-        int32v i = FS_Convertf32_i32( x0 ) * int32v( Primes::X );
-        int32v j = FS_Convertf32_i32( y0 ) * int32v( Primes::Y );
-        int32v k = FS_Convertf32_i32( z0 ) * int32v( Primes::Z );
+        int32v i = FS_Convertf32_i32( x0 ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v j = FS_Convertf32_i32( y0 ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        int32v k = FS_Convertf32_i32( z0 ) * int32v( Primes::Z ) + int32v( offset.primed[2] );
 
         mask32v x_ge_y = FS_GreaterEqualThan_f32( xi, yi );
         mask32v y_ge_z = FS_GreaterEqualThan_f32( yi, zi );
@@ -132,16 +179,19 @@ class FS_T<FastNoise::OpenSimplex2, FS> : public virtual FastNoise::OpenSimplex2
         const float F2 = 0.5f * (SQRT3 - 1.0f);
         const float G2 = (3.0f - SQRT3) / 6.0f;
 
+        float unskewedOffset[2];
+        LatticeOffset offset = SplitSimplexLatticeOffset2D( GetPositionOffset(), F2, G2, unskewedOffset );
+
         float32v f = float32v( F2 ) * (x + y);
-        float32v x0 = FS_Floor_f32( x + f );
-        float32v y0 = FS_Floor_f32( y + f );
+        float32v x0 = FS_Floor_f32( x + f + float32v( offset.fraction[0] ) );
+        float32v y0 = FS_Floor_f32( y + f + float32v( offset.fraction[1] ) );
 
-        int32v i = FS_Convertf32_i32( x0 ) * int32v( Primes::X );
-        int32v j = FS_Convertf32_i32( y0 ) * int32v( Primes::Y );
+        int32v i = FS_Convertf32_i32( x0 ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v j = FS_Convertf32_i32( y0 ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
 
         float32v g = float32v( G2 ) * (x0 + y0);
-        x0 = x - (x0 - g);
-        y0 = y - (y0 - g);
+        x0 = x + float32v( unskewedOffset[0] ) - (x0 - g);
+        y0 = y + float32v( unskewedOffset[1] ) - (y0 - g);
 
         mask32v i1 = FS_GreaterThan_f32( x0, y0 );
         //mask32v j1 = ~i1; //NMasked funcs
@@ -177,6 +227,9 @@ class FS_T<FastNoise::OpenSimplex2, FS> : public virtual FastNoise::OpenSimplex2
         float32v yr = f - y;
         float32v zr = f - z;
 
+        double rotatedOffset[3];
+        LatticeOffset offset = ApplyLatticeOffset( SkewPositionOffset( GetPositionOffset(), 3, -1.0, 2.0f / 3.0f, rotatedOffset ), xr, yr, zr );
+
         float32v val( 0 );
         for( size_t i = 0; i < 2; i++ )
         {
@@ -200,13 +253,13 @@ class FS_T<FastNoise::OpenSimplex2, FS> : public virtual FastNoise::OpenSimplex2
             float32v d1yr = yr - v1yr;
             float32v d1zr = zr - v1zr;
 
-            int32v hv0xr = FS_Convertf32_i32( v0xr ) * int32v( Primes::X );
-            int32v hv0yr = FS_Convertf32_i32( v0yr ) * int32v( Primes::Y );
-            int32v hv0zr = FS_Convertf32_i32( v0zr ) * int32v( Primes::Z );
+            int32v hv0xr = FS_Convertf32_i32( v0xr ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+            int32v hv0yr = FS_Convertf32_i32( v0yr ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+            int32v hv0zr = FS_Convertf32_i32( v0zr ) * int32v( Primes::Z ) + int32v( offset.primed[2] );
 
-            int32v hv1xr = FS_Convertf32_i32( v1xr ) * int32v( Primes::X );
-            int32v hv1yr = FS_Convertf32_i32( v1yr ) * int32v( Primes::Y );
-            int32v hv1zr = FS_Convertf32_i32( v1zr ) * int32v( Primes::Z );
+            int32v hv1xr = FS_Convertf32_i32( v1xr ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+            int32v hv1yr = FS_Convertf32_i32( v1yr ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+            int32v hv1zr = FS_Convertf32_i32( v1zr ) * int32v( Primes::Z ) + int32v( offset.primed[2] );
 
             float32v t0 = FS_FNMulAdd_f32( d0zr, d0zr, FS_FNMulAdd_f32( d0yr, d0yr, FS_FNMulAdd_f32( d0xr, d0xr, float32v( 0.6f ) ) ) );
             float32v t1 = FS_FNMulAdd_f32( d1zr, d1zr, FS_FNMulAdd_f32( d1yr, d1yr, FS_FNMulAdd_f32( d1xr, d1xr, float32v( 0.6f ) ) ) );
@@ -8,11 +8,13 @@ class FS_T<FastNoise::Value, FS> : public virtual FastNoise::Value, public FS_T<
 {
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y ) const final
     {
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y );
+
         float32v xs = FS_Floor_f32( x );
         float32v ys = FS_Floor_f32( y );
 
-        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X );
-        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y );
+        int32v x0 = FS_Convertf32_i32( xs ) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v y0 = FS_Convertf32_i32( ys ) * int32v( Primes::Y ) + int32v( offset.primed[1] );
         int32v x1 = x0 + int32v( Primes::X );
         int32v y1 = y0 + int32v( Primes::Y );
 
@@ -26,13 +28,15 @@ class FS_T<FastNoise::Value, FS> : public virtual FastNoise::Value, public FS_T<
 
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z ) const final
     {
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z );
+
         float32v xs = FS_Floor_f32( x );
         float32v ys = FS_Floor_f32( y );
         float32v zs = FS_Floor_f32( z );
 
-        int32v x0 = FS_Convertf32_i32(xs) * int32v( Primes::X );
-        int32v y0 = FS_Convertf32_i32(ys) * int32v( Primes::Y );
-        int32v z0 = FS_Convertf32_i32(zs) * int32v( Primes::Z );
+        int32v x0 = FS_Convertf32_i32(xs) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v y0 = FS_Convertf32_i32(ys) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        int32v z0 = FS_Convertf32_i32(zs) * int32v( Primes::Z ) + int32v( offset.primed[2] );
         int32v x1 = x0 + int32v( Primes::X );
         int32v y1 = y0 + int32v( Primes::Y );
         int32v z1 = z0 + int32v( Primes::Z );
@@ -51,15 +55,17 @@ class FS_T<FastNoise::Value, FS> : public virtual FastNoise::Value, public FS_T<
 
     float32v FS_VECTORCALL Gen( int32v seed, float32v x, float32v y, float32v z, float32v w ) const final
     {
+        LatticeOffset offset = ApplyLatticeOffset( GetPositionOffset(), x, y, z, w );
+
         float32v xs = FS_Floor_f32( x );
         float32v ys = FS_Floor_f32( y );
         float32v zs = FS_Floor_f32( z );
         float32v ws = FS_Floor_f32( w );
 
-        int32v x0 = FS_Convertf32_i32(xs) * int32v( Primes::X );
-        int32v y0 = FS_Convertf32_i32(ys) * int32v( Primes::Y );
-        int32v z0 = FS_Convertf32_i32(zs) * int32v( Primes::Z );
-        int32v w0 = FS_Convertf32_i32(ws) * int32v( Primes::W );
+        int32v x0 = FS_Convertf32_i32(xs) * int32v( Primes::X ) + int32v( offset.primed[0] );
+        int32v y0 = FS_Convertf32_i32(ys) * int32v( Primes::Y ) + int32v( offset.primed[1] );
+        int32v z0 = FS_Convertf32_i32(zs) * int32v( Primes::Z ) + int32v( offset.primed[2] );
+        int32v w0 = FS_Convertf32_i32(ws) * int32v( Primes::W ) + int32v( offset.primed[3] );
         int32v x1 = x0 + int32v( Primes::X );
         int32v y1 = y0 + int32v( Primes::Y );
         int32v z1 = z0 + int32v( Primes::Z );
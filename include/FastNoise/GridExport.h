@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "Generators/Generator.h"
+
+namespace FastNoise
+{
+    // Out of core grid export: the grid is generated tile by tile in parallel straight into a memory mapped file
+    // Memory use is bounded by the mapped pages the OS keeps resident plus one tile buffer per thread
+    //
+    // File layout, all values little endian:
+    //   GridFileHeader
+    //   GridFileTile[tileCount] at header.tileIndexOffset
+    //   tile data at header.tileDataOffset, tile i at tileDataOffset + i * tileBytes
+    // Tiles are indexed ( tz * yTiles + ty ) * xTiles + tx and hold tileSize^dimensions samples in xyz order
+    // Edge tiles keep the same layout, only samples inside size are generated and the rest of the tile is left zero
+
+    struct GridFileHeader
+    {
+        static constexpr uint32_t kMagic = 0x46474E46; // "FNGF"
+        static constexpr uint32_t kVersion = 1;
+
+        uint32_t magic;
+        uint32_t version;
+        uint32_t dimensions;
+        int32_t tileSize;
+        int32_t start[3];
+        int32_t size[3];
+        int32_t tileCount[3];
+        float frequency;
+        int32_t seed;
+        uint32_t formatType;
+        float rangeMin;
+        float rangeMax;
+        uint32_t perTileRange;
+        uint64_t sourceHash;
+        uint64_t tileIndexOffset;
+        uint64_t tileDataOffset;
+        uint64_t tileBytes;
+    };
+
+    // min/max are of the generated values before quantisation
+    // With per tile range, integer samples map [min, max] of the tile to the full range of the type
+    struct GridFileTile
+    {
+        float min;
+        float max;
+        uint32_t complete;
+        uint32_t reserved;
+    };
+
+    struct GridExportSettings
+    {
+        // 2 or 3, size[2] and start[2] are ignored for 2D
+        int32_t dimensions = 2;
+        int32_t start[3] = {};
+        int32_t size[3] = {};
+        float frequency = 0.01f;
+        int32_t seed = 1337;
+
+        // Samples per tile along each axis
+        int32_t tileSize = 256;
+
+        // Integer formats use format.rangeMin/Max unless perTileRange is set
+        OutputFormat format;
+        bool perTileRange = false;
+
+        // Identifies the node tree in the header, e.g. a hash of its encoded node tree, an existing file is only resumed when it matches
+        // 0 means the node tree is unknown, the file is then recreated instead of resumed
+        uint64_t sourceHash = 0;
+
+        int32_t threadCount = 1;
+
+        // Resume an existing file written with the same settings, skipping completed tiles
+        // When false the file is recreated, when true an existing file with different settings is left untouched and ExportGrid returns false
+        bool resume = true;
+    };
+
+    struct GridExportResult
+    {
+        size_t tilesGenerated = 0;
+        size_t tilesSkipped = 0;
+    };
+
+    // Returns false if the file cannot be created or mapped, or an existing file does not match settings while resuming
+    // Tiles are marked complete in batches once their data is synced to disk, so an interrupted export can be resumed by calling again with the same settings
+    // Only tiles generated since the last batch, up to about 64MB of tile data, are generated again
+    bool ExportGrid( const Generator& generator, const char* path, const GridExportSettings& settings, GridExportResult* result = nullptr );
+}
@@ -0,0 +1,185 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Generators/Generator.h"
+
+namespace FastNoise
+{
+    // One completed tile of a streamed grid, values hold xSize * ySize * zSize floats in xyz order
+    // Only valid during the visitor call, the buffer is reused for the next tile generated on the same thread
+    struct GridTile
+    {
+        // Tile origin in samples relative to the start of the grid
+        int32_t x, y, z;
+        int32_t xSize, ySize, zSize;
+
+        // Tile index in xyz order of the tile grid
+        size_t index;
+
+        // Worker thread the tile was generated on, in [0, threadCount)
+        int32_t threadIndex;
+
+        const float* values;
+        OutputMinMax minMax;
+    };
+
+    namespace Internal
+    {
+        inline void GridTileRange( int32_t tile, int32_t tileCount, int32_t size, int32_t tileSize, int32_t& start, int32_t& tileSizeOut )
+        {
+            start = tile * tileSize;
+            tileSizeOut = tile == tileCount - 1 ? size - start : tileSize;
+        }
+
+        // Runs generate( tileIndex, threadIndex, buffer ) for every tile, tiles are taken from a shared counter so each thread moves on as soon as it finishes
+        // If any tile throws no further tiles are started, all threads are joined and the first exception is rethrown on the calling thread
+        template<typename GenerateTile>
+        OutputMinMax ForEachGridTile( size_t tileCount, size_t bufferSize, int32_t threadCount, GenerateTile&& generate )
+        {
+            threadCount = std::max( 1, std::min<int32_t>( threadCount, (int32_t)tileCount ) );
+
+            std::atomic<size_t> nextTile( 0 );
+            std::mutex minMaxMutex;
+            OutputMinMax minMax;
+            std::exception_ptr firstException;
+
+            // Record the first exception and stop handing out tiles, the remaining threads finish their current tile and exit
+            auto fail = [&]( std::exception_ptr exception )
+            {
+                nextTile = tileCount;
+
+                std::lock_guard<std::mutex> lock( minMaxMutex );
+                if( !firstException )
+                {
+                    firstException = exception;
+                }
+            };
+
+            auto worker = [&]( int32_t threadIndex )
+            {
+                try
+                {
+                    std::vector<float> buffer( bufferSize );
+                    OutputMinMax threadMinMax;
+
+                    for( size_t tile = nextTile++; tile < tileCount; tile = nextTile++ )
+                    {
+                        threadMinMax << generate( tile, threadIndex, buffer.data() );
+                    }
+
+                    std::lock_guard<std::mutex> lock( minMaxMutex );
+                    minMax << threadMinMax;
+                }
+                catch( ... )
+                {
+                    fail( std::current_exception() );
+                }
+            };
+
+            std::vector<std::thread> threads;
+
+            try
+            {
+                threads.reserve( threadCount - 1 );
+
+                for( int32_t i = 1; i < threadCount; i++ )
+                {
+                    threads.emplace_back( worker, i );
+                }
+            }
+            catch( ... )
+            {
+                fail( std::current_exception() );
+            }
+
+            worker( 0 );
+
+            for( std::thread& thread : threads )
+            {
+                thread.join();
+            }
+
+            if( firstException )
+            {
+                std::rethrow_exception( firstException );
+            }
+
+            return minMax;
+        }
+    }
+
+    // Streamed grid generation: the grid is generated tile by tile into a reusable buffer and each completed tile is passed to visitor( const GridTile& )
+    // Memory is bounded by one tile buffer per thread regardless of grid size, edge tiles are narrower when size is not a multiple of tileSize
+    // With threadCount > 1 tiles are generated on worker threads and the visitor is called concurrently from those threads as tiles finish, in no particular order
+    // An exception thrown by the visitor stops the remaining tiles and is rethrown from here once all threads have finished
+    // Returns the min/max of the whole grid
+
+    template<typename Visitor>
+    OutputMinMax GenUniformGrid2DTiled( const Generator& generator, Visitor&& visitor,
+        int32_t xStart, int32_t yStart,
+        int32_t xSize, int32_t ySize,
+        float frequency, int32_t seed, int32_t tileSize = 256, int32_t threadCount = 1 )
+    {
+        assert( tileSize > 0 );
+
+        int32_t xTiles = ( xSize + tileSize - 1 ) / tileSize;
+        int32_t yTiles = ( ySize + tileSize - 1 ) / tileSize;
+
+        size_t bufferSize = (size_t)tileSize * tileSize;
+
+        return Internal::ForEachGridTile( (size_t)xTiles * yTiles, bufferSize, threadCount, [&]( size_t index, int32_t threadIndex, float* buffer )
+        {
+            GridTile tile;
+            tile.index = index;
+            tile.threadIndex = threadIndex;
+            tile.values = buffer;
+            tile.z = 0;
+            tile.zSize = 1;
+
+            Internal::GridTileRange( (int32_t)( index % xTiles ), xTiles, xSize, tileSize, tile.x, tile.xSize );
+            Internal::GridTileRange( (int32_t)( index / xTiles ), yTiles, ySize, tileSize, tile.y, tile.ySize );
+
+            tile.minMax = generator.GenUniformGrid2D( buffer, xStart + tile.x, yStart + tile.y, tile.xSize, tile.ySize, frequency, seed );
+
+            visitor( static_cast<const GridTile&>( tile ) );
+            return tile.minMax;
+        } );
+    }
+
+    template<typename Visitor>
+    OutputMinMax GenUniformGrid3DTiled( const Generator& generator, Visitor&& visitor,
+        int32_t xStart, int32_t yStart, int32_t zStart,
+        int32_t xSize,  int32_t ySize,  int32_t zSize,
+        float frequency, int32_t seed, int32_t tileSize = 64, int32_t threadCount = 1 )
+    {
+        assert( tileSize > 0 );
+
+        int32_t xTiles = ( xSize + tileSize - 1 ) / tileSize;
+        int32_t yTiles = ( ySize + tileSize - 1 ) / tileSize;
+        int32_t zTiles = ( zSize + tileSize - 1 ) / tileSize;
+
+        size_t bufferSize = (size_t)tileSize * tileSize * tileSize;
+
+        return Internal::ForEachGridTile( (size_t)xTiles * yTiles * zTiles, bufferSize, threadCount, [&]( size_t index, int32_t threadIndex, float* buffer )
+        {
+            GridTile tile;
+            tile.index = index;
+            tile.threadIndex = threadIndex;
+            tile.values = buffer;
+
+            Internal::GridTileRange( (int32_t)( index % xTiles ), xTiles, xSize, tileSize, tile.x, tile.xSize );
+            Internal::GridTileRange( (int32_t)( index / xTiles % yTiles ), yTiles, ySize, tileSize, tile.y, tile.ySize );
+            Internal::GridTileRange( (int32_t)( index / xTiles / yTiles ), zTiles, zSize, tileSize, tile.z, tile.zSize );
+
+            tile.minMax = generator.GenUniformGrid3D( buffer, xStart + tile.x, yStart + tile.y, zStart + tile.z, tile.xSize, tile.ySize, tile.zSize, frequency, seed );
+
+            visitor( static_cast<const GridTile&>( tile ) );
+            return tile.minMax;
+        } );
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FastNoise
+{
+    // 3D grid stored as cubic bricks, bricks with uniform values keep a single constant instead of their samples
+    // Filled by Generator::GenUniformGrid3D( SparseVolume&, ... ), dense bricks hold brickSize^3 floats in xyz order
+    class SparseVolume
+    {
+    public:
+        // Clears all bricks, sizes must be multiples of brickSize
+        void Reset( int32_t brickSize, int32_t xSize, int32_t ySize, int32_t zSize );
+
+        int32_t GetBrickSize() const { return mBrickSize; }
+        int32_t GetXSize() const { return mXBricks * mBrickSize; }
+        int32_t GetYSize() const { return mYBricks * mBrickSize; }
+        int32_t GetZSize() const { return mZBricks * mBrickSize; }
+
+        size_t GetBrickCount() const { return mBricks.size(); }
+        size_t GetDenseBrickCount() const { return mDenseValues.size() / BrickVolume(); }
+
+        // Bytes used by brick headers and dense samples
+        size_t GetMemoryUsage() const { return mBricks.size() * sizeof( Brick ) + mDenseValues.size() * sizeof( float ); }
+
+        // Brick coordinates are in bricks, brick index is ( bz * yBricks + by ) * xBricks + bx
+        size_t GetBrickIndex( int32_t bx, int32_t by, int32_t bz ) const { return ( (size_t)bz * mYBricks + by ) * mXBricks + bx; }
+
+        bool IsBrickUniform( size_t brickIndex ) const { return mBricks[brickIndex].denseOffset == kUniform; }
+        float GetBrickConstant( size_t brickIndex ) const { return mBricks[brickIndex].constant; }
+
+        // nullptr for uniform bricks
+        const float* GetBrickValues( size_t brickIndex ) const;
+
+        float GetValue( int32_t x, int32_t y, int32_t z ) const;
+
+        // Used during generation, bricks must be set in brick index order
+        void AddUniformBrick( float constant );
+        void AddDenseBrick( const float* values );
+
+    private:
+        static constexpr size_t kUniform = ~(size_t)0;
+
+        struct Brick
+        {
+            size_t denseOffset;
+            float constant;
+        };
+
+        size_t BrickVolume() const { return (size_t)mBrickSize * mBrickSize * mBrickSize; }
+
+        int32_t mBrickSize = 8;
+        int32_t mXBricks = 0;
+        int32_t mYBricks = 0;
+        int32_t mZBricks = 0;
+        std::vector<Brick> mBricks;
+        std::vector<float> mDenseValues;
+    };
+}
@@ -62,6 +62,61 @@
 /// </code>
 #define FS_Load_i32( ... ) FS::Load_i32( __VA_ARGS__ )
 
+/// <summary>
+/// Loads one float per element from ptr[ idx[element] ]
+/// </summary>
+/// <remarks>
+/// All indices must be valid for the given memory location
+/// </remarks>
+/// <code>
+/// float32v FS_Gather_f32( void const* ptr, int32v idx )
+/// </code>
+#define FS_Gather_f32( ... ) FS::Gather_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Loads one interleaved { x, y } float pair per element from ptr + element * stride
+/// </summary>
+/// <remarks>
+/// Stride is in bytes, only the 8 bytes of each pair are read
+/// </remarks>
+/// <code>
+/// void FS_LoadTransposed2_f32( void const* ptr, size_t stride, float32v& x, float32v& y )
+/// </code>
+#define FS_LoadTransposed2_f32( ... ) FS::LoadTransposed2_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Loads one interleaved { x, y, z } float triple per element from ptr + element * stride
+/// </summary>
+/// <remarks>
+/// Stride is in bytes, only the 12 bytes of each triple are read
+/// </remarks>
+/// <code>
+/// void FS_LoadTransposed3_f32( void const* ptr, size_t stride, float32v& x, float32v& y, float32v& z )
+/// </code>
+#define FS_LoadTransposed3_f32( ... ) FS::LoadTransposed3_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Loads elements where mask is set, other elements are 0
+/// </summary>
+/// <remarks>
+/// Memory of masked off elements is not accessed, safe to use on the tail of a buffer
+/// </remarks>
+/// <code>
+/// float32v FS_MaskedLoad_f32( void const* ptr, mask32v m )
+/// </code>
+#define FS_MaskedLoad_f32( ... ) FS::MaskedLoad_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Loads elements where mask is set, other elements are 0
+/// </summary>
+/// <remarks>
+/// Memory of masked off elements is not accessed, safe to use on the tail of a buffer
+/// </remarks>
+/// <code>
+/// int32v FS_MaskedLoad_i32( void const* ptr, mask32v m )
+/// </code>
+#define FS_MaskedLoad_i32( ... ) FS::MaskedLoad_i32( __VA_ARGS__ )
+
 
 // Store
 
@@ -81,6 +136,97 @@
 /// </code>
 #define FS_Store_i32( ... ) FS::Store_i32( __VA_ARGS__ )
 
+/// <summary>
+/// Copies elements where mask is set to given memory location
+/// </summary>
+/// <remarks>
+/// Memory of masked off elements is not accessed
+/// </remarks>
+/// <code>
+/// void FS_MaskedStore_f32( void* ptr, float32v f, mask32v m )
+/// </code>
+#define FS_MaskedStore_f32( ... ) FS::MaskedStore_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Copies all elements of float32v to given memory location bypassing the cache
+/// </summary>
+/// <remarks>
+/// ptr must be aligned to sizeof( float32v ), follow with FS_StoreFence() before the memory is read by another thread
+/// </remarks>
+/// <code>
+/// void FS_StoreNonTemporal_f32( void* ptr, float32v f )
+/// </code>
+#define FS_StoreNonTemporal_f32( ... ) FS::StoreNonTemporal_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Orders all previous stores, including non temporal stores, before any following stores
+/// </summary>
+/// <code>
+/// void FS_StoreFence()
+/// </code>
+#define FS_StoreFence() FS::StoreFence()
+
+/// <summary>
+/// Returns the first element of float32v
+/// </summary>
+/// <code>
+/// float FS_Extract0_f32( float32v f )
+/// </code>
+#define FS_Extract0_f32( ... ) FS::Extract0_f32( __VA_ARGS__ )
+
+/// <summary>
+/// Returns a bit mask of the mask elements, bit i is set when element i is set
+/// </summary>
+/// <code>
+/// uint32_t FS_MoveMask_m32( mask32v m )
+/// </code>
+#define FS_MoveMask_m32( ... ) FS::MoveMask_m32( __VA_ARGS__ )
+
+/// <summary>
+/// Packs elements to uint8 with saturation and copies them to given memory location
+/// </summary>
+/// <remarks>
+/// Writes FS_Size_32() bytes
+/// </remarks>
+/// <code>
+/// void FS_StorePacked_u8( void* ptr, int32v i )
+/// </code>
+#define FS_StorePacked_u8( ... ) FS::StorePacked_u8( __VA_ARGS__ )
+
+/// <summary>
+/// Packs elements to uint16 with saturation and copies them to given memory location
+/// </summary>
+/// <remarks>
+/// Writes FS_Size_32() uint16 values
+/// </remarks>
+/// <code>
+/// void FS_StorePacked_u16( void* ptr, int32v i )
+/// </code>
+#define FS_StorePacked_u16( ... ) FS::StorePacked_u16( __VA_ARGS__ )
+
+/// <summary>
+/// Packs elements to int16 with saturation and copies them to given memory location
+/// </summary>
+/// <remarks>
+/// Writes FS_Size_32() int16 values
+/// </remarks>
+/// <code>
+/// void FS_StorePacked_i16( void* ptr, int32v i )
+/// </code>
+#define FS_StorePacked_i16( ... ) FS::StorePacked_i16( __VA_ARGS__ )
+
+/// <summary>
+/// Converts elements to IEEE half precision floats and copies them to given memory location
+/// </summary>
+/// <remarks>
+/// Rounds to nearest even, out of range values become infinity
+/// Uses F16C instructions where available
+/// </remarks>
+/// <code>
+/// void FS_StorePacked_f16( void* ptr, float32v f )
+/// </code>
+#define FS_StorePacked_f16( ... ) FS::StorePacked_f16( __VA_ARGS__ )
+
 
 // Cast
 
@@ -0,0 +1,126 @@
+#include "FastNoise/Generators/Baked.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Resolution reduced to fit one grid in the budget, 0 if not even a kMinResolution grid fits
+int FastNoise::Baked::GetBakeResolution( int dimensions ) const
+{
+    double budgetValues = std::max( 0.0, (double)mMemoryBudgetMB * 1024.0 * 1024.0 / sizeof( float ) );
+    int budgetResolution = (int)std::floor( std::pow( budgetValues, 1.0 / dimensions ) + 1e-9 );
+
+    int resolution = std::min( std::max( kMinResolution, mResolution ), budgetResolution );
+
+    return resolution < kMinResolution ? 0 : resolution;
+}
+
+const FastNoise::Baked::Grid* FastNoise::Baked::BakeGrid( int dimensions, int32_t seed ) const
+{
+    int gridIdx = dimensions - 2;
+
+    std::lock_guard<std::mutex> lock( mBakeMutex );
+
+    size_t gridCount = mGridCount[gridIdx].load( std::memory_order_relaxed );
+
+    for( size_t i = 0; i < gridCount; i++ )
+    {
+        if( mGrids[gridIdx][i].seed == seed )
+        {
+            return &mGrids[gridIdx][i];
+        }
+    }
+
+    int resolution = GetBakeResolution( dimensions );
+
+    if( resolution == 0 )
+    {
+        return nullptr;
+    }
+
+    size_t gridValues = (size_t)resolution * resolution * ( dimensions == 3 ? resolution : 1 );
+    double budgetValues = (double)mMemoryBudgetMB * 1024.0 * 1024.0 / sizeof( float );
+
+    if( gridCount >= (size_t)kMaxBakedSeeds || (double)( gridValues * ( gridCount + 1 ) ) > budgetValues )
+    {
+        return nullptr;
+    }
+
+    if( !mGrids[gridIdx] )
+    {
+        mGrids[gridIdx].reset( new Grid[kMaxBakedSeeds] );
+    }
+
+    Grid& grid = mGrids[gridIdx][gridCount];
+    grid.resolution = resolution;
+    grid.seed = seed;
+    grid.values.assign( gridValues, 0.0f );
+
+    float frequency = mPeriod > 0.0f ? mPeriod / resolution : 1.0f;
+    float resolutionRecip = 1.0f / resolution;
+
+    // Blend each sample with the source shifted back one period along each axis, weighted by the position in the period
+    // At position 0 only the unshifted source contributes and at the period only the shifted one, so the grid wraps seamlessly
+    auto weight = [resolutionRecip]( int shifted, int32_t idx )
+    {
+        float t = idx * resolutionRecip;
+        return shifted ? t : 1.0f - t;
+    };
+
+    std::vector<float> slice( (size_t)resolution * resolution );
+    int zShifts = dimensions == 3 ? 2 : 1;
+    int zCount = dimensions == 3 ? resolution : 1;
+
+    for( int32_t z = 0; z < zCount; z++ )
+    {
+        float* out = grid.values.data() + (size_t)z * resolution * resolution;
+
+        for( int zShift = 0; zShift < zShifts; zShift++ )
+        {
+            float zWeight = dimensions == 3 ? weight( zShift, z ) : 1.0f;
+
+            for( int yShift = 0; yShift < 2; yShift++ )
+            {
+                for( int xShift = 0; xShift < 2; xShift++ )
+                {
+                    if( dimensions == 3 )
+                    {
+                        mSource.base->GenUniformGrid3D( slice.data(), -xShift * resolution, -yShift * resolution, z - zShift * resolution,
+                            resolution, resolution, 1, frequency, seed );
+                    }
+                    else
+                    {
+                        mSource.base->GenUniformGrid2D( slice.data(), -xShift * resolution, -yShift * resolution,
+                            resolution, resolution, frequency, seed );
+                    }
+
+                    size_t index = 0;
+
+                    for( int32_t y = 0; y < resolution; y++ )
+                    {
+                        float yzWeight = weight( yShift, y ) * zWeight;
+
+                        for( int32_t x = 0; x < resolution; x++ )
+                        {
+                            out[index] += slice[index] * weight( xShift, x ) * yzWeight;
+                            index++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    mGridCount[gridIdx].store( gridCount + 1, std::memory_order_release );
+    return &grid;
+}
+
+void FastNoise::Baked::Invalidate()
+{
+    std::lock_guard<std::mutex> lock( mBakeMutex );
+
+    for( int i = 0; i < 2; i++ )
+    {
+        mGridCount[i].store( 0, std::memory_order_relaxed );
+        mGrids[i].reset();
+    }
+}
@@ -0,0 +1,172 @@
+#include "FastNoise/ChunkCache.h"
+
+#include <cstring>
+#include <exception>
+
+bool FastNoise::ChunkCache::Key::operator ==( const Key& other ) const
+{
+    return treeHash == other.treeHash && seed == other.seed && frequencyBits == other.frequencyBits && dimensions == other.dimensions &&
+        memcmp( start, other.start, sizeof( start ) ) == 0 && memcmp( size, other.size, sizeof( size ) ) == 0;
+}
+
+size_t FastNoise::ChunkCache::KeyHash::operator ()( const Key& key ) const
+{
+    uint64_t hash = key.treeHash;
+
+    auto combine = [&hash]( uint64_t value )
+    {
+        hash = ( hash ^ value ) * 0x100000001b3ull;
+        hash ^= hash >> 29;
+    };
+
+    combine( (uint32_t)key.seed );
+    combine( key.frequencyBits );
+    combine( (uint32_t)key.dimensions );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        combine( (uint32_t)key.start[i] );
+        combine( (uint32_t)key.size[i] );
+    }
+    return (size_t)hash;
+}
+
+FastNoise::ChunkCache::ChunkPtr FastNoise::ChunkCache::GetUniformGrid2D( const Generator& generator, uint64_t treeHash,
+    int32_t xStart, int32_t yStart, int32_t xSize, int32_t ySize, float frequency, int32_t seed )
+{
+    Key key = { treeHash, seed, 0, 2, { xStart, yStart, 0 }, { xSize, ySize, 1 } };
+    memcpy( &key.frequencyBits, &frequency, sizeof( float ) );
+
+    return GetChunk( key, [&]( Chunk& chunk )
+    {
+        chunk.values.resize( (size_t)xSize * ySize );
+        chunk.minMax = generator.GenUniformGrid2D( chunk.values.data(), xStart, yStart, xSize, ySize, frequency, seed );
+    } );
+}
+
+FastNoise::ChunkCache::ChunkPtr FastNoise::ChunkCache::GetUniformGrid3D( const Generator& generator, uint64_t treeHash,
+    int32_t xStart, int32_t yStart, int32_t zStart, int32_t xSize, int32_t ySize, int32_t zSize, float frequency, int32_t seed )
+{
+    Key key = { treeHash, seed, 0, 3, { xStart, yStart, zStart }, { xSize, ySize, zSize } };
+    memcpy( &key.frequencyBits, &frequency, sizeof( float ) );
+
+    return GetChunk( key, [&]( Chunk& chunk )
+    {
+        chunk.values.resize( (size_t)xSize * ySize * zSize );
+        chunk.minMax = generator.GenUniformGrid3D( chunk.values.data(), xStart, yStart, zStart, xSize, ySize, zSize, frequency, seed );
+    } );
+}
+
+template<typename GenerateFunc>
+FastNoise::ChunkCache::ChunkPtr FastNoise::ChunkCache::GetChunk( const Key& key, GenerateFunc&& generate )
+{
+    std::promise<ChunkPtr> promise;
+    {
+        std::unique_lock<std::mutex> lock( mMutex );
+
+        auto entry = mEntries.find( key );
+        if( entry != mEntries.end() )
+        {
+            mHits++;
+            mLru.splice( mLru.begin(), mLru, entry->second.lruPosition );
+            return entry->second.chunk;
+        }
+
+        auto inFlight = mInFlight.find( key );
+        if( inFlight != mInFlight.end() )
+        {
+            mHits++;
+            mInFlightHits++;
+            std::shared_future<ChunkPtr> future = inFlight->second;
+
+            lock.unlock();
+            return future.get();
+        }
+
+        mMisses++;
+        mInFlight.emplace( key, promise.get_future().share() );
+    }
+
+    // Generate outside the lock so other chunks can be served meanwhile
+    std::shared_ptr<Chunk> chunk;
+    try
+    {
+        chunk = std::make_shared<Chunk>();
+        generate( *chunk );
+    }
+    catch( ... )
+    {
+        // Waiting requests receive the same exception, later requests retry the generation
+        {
+            std::lock_guard<std::mutex> lock( mMutex );
+            mInFlight.erase( key );
+        }
+
+        promise.set_exception( std::current_exception() );
+        throw;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( mMutex );
+
+        mInFlight.erase( key );
+
+        // Chunks larger than the whole cache are returned without being cached
+        size_t chunkBytes = ChunkBytes( *chunk );
+        if( chunkBytes <= mMaxBytes )
+        {
+            EvictToFit( mMaxBytes - chunkBytes );
+
+            mLru.push_front( key );
+            mEntries.emplace( key, Entry{ chunk, mLru.begin() } );
+            mBytes += chunkBytes;
+        }
+    }
+
+    promise.set_value( chunk );
+    return chunk;
+}
+
+void FastNoise::ChunkCache::EvictToFit( size_t maxBytes )
+{
+    while( mBytes > maxBytes && !mLru.empty() )
+    {
+        auto entry = mEntries.find( mLru.back() );
+
+        mBytes -= ChunkBytes( *entry->second.chunk );
+        mEntries.erase( entry );
+        mLru.pop_back();
+        mEvictions++;
+    }
+}
+
+FastNoise::ChunkCache::Counters FastNoise::ChunkCache::GetCounters() const
+{
+    std::lock_guard<std::mutex> lock( mMutex );
+
+    Counters counters;
+    counters.hits = mHits;
+    counters.misses = mMisses;
+    counters.inFlightHits = mInFlightHits;
+    counters.evictions = mEvictions;
+    counters.bytes = mBytes;
+    counters.chunkCount = mEntries.size();
+    return counters;
+}
+
+void FastNoise::ChunkCache::SetMaxBytes( size_t maxBytes )
+{
+    std::lock_guard<std::mutex> lock( mMutex );
+
+    mMaxBytes = maxBytes;
+    EvictToFit( maxBytes );
+}
+
+void FastNoise::ChunkCache::Clear()
+{
+    std::lock_guard<std::mutex> lock( mMutex );
+
+    mEntries.clear();
+    mLru.clear();
+    mBytes = 0;
+}
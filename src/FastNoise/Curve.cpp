@@ -0,0 +1,160 @@
+#include "FastNoise/Generators/Modifiers.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+
+bool FastNoise::Curve::SetPoints( const char* points )
+{
+    if( !points )
+    {
+        return false;
+    }
+
+    std::vector<std::pair<float, float>> parsed;
+    const char* cursor = points;
+
+    while( true )
+    {
+        while( std::isspace( (unsigned char)*cursor ) || *cursor == ',' || *cursor == ';' )
+        {
+            cursor++;
+        }
+
+        if( *cursor == '\0' )
+        {
+            break;
+        }
+
+        char* end;
+        float x = std::strtof( cursor, &end );
+        if( end == cursor )
+        {
+            return false;
+        }
+        cursor = end;
+
+        float y = std::strtof( cursor, &end );
+        if( end == cursor )
+        {
+            return false;
+        }
+        cursor = end;
+
+        parsed.emplace_back( x, y );
+    }
+
+    return SetPoints( parsed );
+}
+
+bool FastNoise::Curve::SetPoints( const std::vector<std::pair<float, float>>& points )
+{
+    if( points.empty() )
+    {
+        return false;
+    }
+
+    for( const auto& point : points )
+    {
+        if( !std::isfinite( point.first ) || !std::isfinite( point.second ) )
+        {
+            return false;
+        }
+    }
+
+    mPoints = points;
+    std::stable_sort( mPoints.begin(), mPoints.end(), []( const auto& a, const auto& b ) { return a.first < b.first; } );
+
+    BakeTable();
+    return true;
+}
+
+void FastNoise::Curve::BakeTable()
+{
+    size_t count = mPoints.size();
+    float domainSize = mPoints.back().first - mPoints.front().first;
+
+    mDomainMin = mPoints.front().first;
+    mDomainScale = domainSize > 0.0f ? kTableSize / domainSize : 0.0f;
+
+    // Monotone cubic Hermite tangents (Fritsch-Carlson) to avoid overshoot between points
+    std::vector<float> tangents( count, 0.0f );
+
+    if( mInterpolation == Interpolation::Cubic && count > 1 )
+    {
+        std::vector<float> secants( count - 1 );
+
+        for( size_t i = 0; i < count - 1; i++ )
+        {
+            float dx = mPoints[i + 1].first - mPoints[i].first;
+            secants[i] = dx > 0.0f ? (mPoints[i + 1].second - mPoints[i].second) / dx : 0.0f;
+        }
+
+        tangents.front() = secants.front();
+        tangents.back() = secants.back();
+
+        for( size_t i = 1; i < count - 1; i++ )
+        {
+            tangents[i] = secants[i - 1] * secants[i] <= 0.0f ? 0.0f : (secants[i - 1] + secants[i]) * 0.5f;
+        }
+
+        for( size_t i = 0; i < count - 1; i++ )
+        {
+            if( secants[i] == 0.0f )
+            {
+                tangents[i] = tangents[i + 1] = 0.0f;
+                continue;
+            }
+
+            float a = tangents[i] / secants[i];
+            float b = tangents[i + 1] / secants[i];
+            float h = a * a + b * b;
+
+            if( h > 9.0f )
+            {
+                float t = 3.0f / std::sqrt( h );
+                tangents[i] = t * a * secants[i];
+                tangents[i + 1] = t * b * secants[i];
+            }
+        }
+    }
+
+    size_t segment = 0;
+
+    for( int i = 0; i <= kTableSize; i++ )
+    {
+        float x = mDomainMin + (domainSize * i) / kTableSize;
+
+        while( segment + 2 < count && x > mPoints[segment + 1].first )
+        {
+            segment++;
+        }
+
+        if( count == 1 )
+        {
+            mTable[i] = mPoints.front().second;
+            continue;
+        }
+
+        const auto& p0 = mPoints[segment];
+        const auto& p1 = mPoints[segment + 1];
+        float dx = p1.first - p0.first;
+        float t = dx > 0.0f ? std::min( std::max( (x - p0.first) / dx, 0.0f ), 1.0f ) : 1.0f;
+
+        if( mInterpolation == Interpolation::Cubic )
+        {
+            float t2 = t * t;
+            float t3 = t2 * t;
+
+            mTable[i] = (2 * t3 - 3 * t2 + 1) * p0.second +
+                (t3 - 2 * t2 + t) * dx * tangents[segment] +
+                (-2 * t3 + 3 * t2) * p1.second +
+                (t3 - t2) * dx * tangents[segment + 1];
+        }
+        else
+        {
+            mTable[i] = p0.second + (p1.second - p0.second) * t;
+        }
+    }
+}
@@ -0,0 +1,420 @@
+#include "FastNoise/Generators/Expression.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    // Recursive descent parser building a list of values in evaluation order
+    // Identical leaves (sources, positions, constants) and operations are shared, operations on constants are folded
+    // Registers are then assigned to the values the result depends on and released after their last use
+    template<typename Instruction, typename Op>
+    class ExpressionCompiler
+    {
+    public:
+        ExpressionCompiler( const char* expression, std::vector<Instruction>& bytecode ) :
+            mCursor( expression ), mBytecode( bytecode ) {}
+
+        bool Compile( uint8_t& resultRegister )
+        {
+            int result = ParseExpression();
+
+            SkipWhitespace();
+            if( result < 0 || *mCursor != '\0' )
+            {
+                return false;
+            }
+
+            return AllocateRegisters( result, resultRegister );
+        }
+
+    private:
+        struct Value
+        {
+            Op op;
+            int args[3] = { -1, -1, -1 };
+            uint8_t leafIndex = 0;
+            float constant = 0.0f;
+        };
+
+        // Values nothing reads, such as constants consumed by folding, emit no instructions
+        bool AllocateRegisters( int result, uint8_t& resultRegister )
+        {
+            size_t valueCount = mValues.size();
+            std::vector<bool> live( valueCount, false );
+            std::vector<size_t> lastUse( valueCount, valueCount );
+
+            live[result] = true;
+
+            // Walking backwards the first reader found is the last use
+            for( size_t i = valueCount; i-- > 0; )
+            {
+                if( !live[i] )
+                {
+                    continue;
+                }
+
+                for( int arg : mValues[i].args )
+                {
+                    if( arg >= 0 && !live[arg] )
+                    {
+                        live[arg] = true;
+                        lastUse[arg] = i;
+                    }
+                }
+            }
+
+            bool registerInUse[FastNoise::Expression::kMaxRegisters] = {};
+            std::vector<uint8_t> valueRegister( valueCount, 0 );
+
+            for( size_t i = 0; i < valueCount; i++ )
+            {
+                if( !live[i] )
+                {
+                    continue;
+                }
+
+                const Value& value = mValues[i];
+
+                // Operands are read before the result is written, so their registers can be reused for it
+                for( int arg : value.args )
+                {
+                    if( arg >= 0 && lastUse[arg] == i )
+                    {
+                        registerInUse[valueRegister[arg]] = false;
+                    }
+                }
+
+                int dst = 0;
+                while( dst < FastNoise::Expression::kMaxRegisters && registerInUse[dst] )
+                {
+                    dst++;
+                }
+
+                if( dst == FastNoise::Expression::kMaxRegisters )
+                {
+                    return false;
+                }
+
+                registerInUse[dst] = true;
+                valueRegister[i] = (uint8_t)dst;
+
+                Instruction instruction;
+                instruction.op = value.op;
+                instruction.dst = (uint8_t)dst;
+                instruction.constant = value.constant;
+
+                if( value.op == Op::Source || value.op == Op::Position )
+                {
+                    instruction.a = value.leafIndex;
+                }
+                else
+                {
+                    instruction.a = value.args[0] < 0 ? 0 : valueRegister[value.args[0]];
+                    instruction.b = value.args[1] < 0 ? 0 : valueRegister[value.args[1]];
+                    instruction.c = value.args[2] < 0 ? 0 : valueRegister[value.args[2]];
+                }
+                mBytecode.push_back( instruction );
+            }
+
+            resultRegister = valueRegister[result];
+            return true;
+        }
+
+        void SkipWhitespace()
+        {
+            while( std::isspace( (unsigned char)*mCursor ) )
+            {
+                mCursor++;
+            }
+        }
+
+        bool Accept( char c )
+        {
+            SkipWhitespace();
+            if( *mCursor == c )
+            {
+                mCursor++;
+                return true;
+            }
+            return false;
+        }
+
+        int Leaf( Op op, uint8_t index, float constant = 0.0f )
+        {
+            for( size_t i = 0; i < mValues.size(); i++ )
+            {
+                const Value& value = mValues[i];
+
+                if( value.op == op && value.leafIndex == index &&
+                    (op != Op::Constant || std::memcmp( &value.constant, &constant, sizeof( float ) ) == 0) )
+                {
+                    return (int)i;
+                }
+            }
+
+            Value value;
+            value.op = op;
+            value.leafIndex = index;
+            value.constant = constant;
+            mValues.push_back( value );
+            return (int)mValues.size() - 1;
+        }
+
+        static float Fold( Op op, float a, float b, float c )
+        {
+            switch( op )
+            {
+            case Op::Add:   return a + b;
+            case Op::Sub:   return a - b;
+            case Op::Mul:   return a * b;
+            case Op::Div:   return a / b;
+            case Op::Neg:   return -a;
+            case Op::Min:   return fminf( a, b );
+            case Op::Max:   return fmaxf( a, b );
+            case Op::Clamp: return fminf( fmaxf( a, b ), c );
+            case Op::Lerp:  return a + (b - a) * c;
+            case Op::Abs:   return fabsf( a );
+            case Op::Sqrt:  return sqrtf( a );
+            case Op::Floor: return floorf( a );
+            case Op::Ceil:  return ceilf( a );
+            case Op::Round: return nearbyintf( a );
+            case Op::Sin:   return sinf( a );
+            case Op::Cos:   return cosf( a );
+            default:        return 0.0f;
+            }
+        }
+
+        int Emit( Op op, int a, int b = -1, int c = -1 )
+        {
+            if( a < 0 || (b < 0 && b != -1) || (c < 0 && c != -1) )
+            {
+                return -2;
+            }
+
+            auto isConstant = [this]( int arg ) { return arg == -1 || mValues[arg].op == Op::Constant; };
+
+            if( isConstant( a ) && isConstant( b ) && isConstant( c ) )
+            {
+                float value = Fold( op, mValues[a].constant,
+                    b == -1 ? 0.0f : mValues[b].constant,
+                    c == -1 ? 0.0f : mValues[c].constant );
+
+                return Leaf( Op::Constant, 0, value );
+            }
+
+            for( size_t i = 0; i < mValues.size(); i++ )
+            {
+                const Value& value = mValues[i];
+
+                if( value.op == op && value.args[0] == a && value.args[1] == b && value.args[2] == c )
+                {
+                    return (int)i;
+                }
+            }
+
+            Value value;
+            value.op = op;
+            value.args[0] = a;
+            value.args[1] = b;
+            value.args[2] = c;
+            mValues.push_back( value );
+            return (int)mValues.size() - 1;
+        }
+
+        int ParseExpression()
+        {
+            int lhs = ParseTerm();
+
+            while( lhs >= 0 )
+            {
+                if( Accept( '+' ) )
+                {
+                    lhs = Emit( Op::Add, lhs, ParseTerm() );
+                }
+                else if( Accept( '-' ) )
+                {
+                    lhs = Emit( Op::Sub, lhs, ParseTerm() );
+                }
+                else
+                {
+                    break;
+                }
+            }
+            return lhs;
+        }
+
+        int ParseTerm()
+        {
+            int lhs = ParseUnary();
+
+            while( lhs >= 0 )
+            {
+                if( Accept( '*' ) )
+                {
+                    lhs = Emit( Op::Mul, lhs, ParseUnary() );
+                }
+                else if( Accept( '/' ) )
+                {
+                    lhs = Emit( Op::Div, lhs, ParseUnary() );
+                }
+                else
+                {
+                    break;
+                }
+            }
+            return lhs;
+        }
+
+        int ParseUnary()
+        {
+            if( Accept( '-' ) )
+            {
+                return Emit( Op::Neg, ParseUnary() );
+            }
+            if( Accept( '+' ) )
+            {
+                return ParseUnary();
+            }
+            return ParsePrimary();
+        }
+
+        int ParsePrimary()
+        {
+            SkipWhitespace();
+
+            if( Accept( '(' ) )
+            {
+                int inner = ParseExpression();
+                return Accept( ')' ) ? inner : -2;
+            }
+
+            if( std::isdigit( (unsigned char)*mCursor ) || *mCursor == '.' )
+            {
+                char* end;
+                float value = std::strtof( mCursor, &end );
+
+                if( end == mCursor )
+                {
+                    return -2;
+                }
+                mCursor = end;
+                return Leaf( Op::Constant, 0, value );
+            }
+
+            const char* identStart = mCursor;
+            while( std::isalnum( (unsigned char)*mCursor ) || *mCursor == '_' )
+            {
+                mCursor++;
+            }
+            size_t identLength = mCursor - identStart;
+
+            if( identLength == 0 )
+            {
+                return -2;
+            }
+
+            if( identLength == 1 && !Accept( '(' ) )
+            {
+                char c = *identStart;
+
+                if( c >= 'a' && c <= 'h' )
+                {
+                    return Leaf( Op::Source, (uint8_t)(c - 'a') );
+                }
+
+                const char* positions = "xyzw";
+                if( const char* dim = std::strchr( positions, c ) )
+                {
+                    return Leaf( Op::Position, (uint8_t)(dim - positions) );
+                }
+                return -2;
+            }
+
+            struct Function
+            {
+                const char* name;
+                Op op;
+                int argCount;
+            };
+
+            static const Function functions[] =
+            {
+                { "min",   Op::Min,   2 },
+                { "max",   Op::Max,   2 },
+                { "clamp", Op::Clamp, 3 },
+                { "lerp",  Op::Lerp,  3 },
+                { "abs",   Op::Abs,   1 },
+                { "sqrt",  Op::Sqrt,  1 },
+                { "floor", Op::Floor, 1 },
+                { "ceil",  Op::Ceil,  1 },
+                { "round", Op::Round, 1 },
+                { "sin",   Op::Sin,   1 },
+                { "cos",   Op::Cos,   1 },
+            };
+
+            if( identLength == 2 && std::strncmp( identStart, "pi", 2 ) == 0 )
+            {
+                return Leaf( Op::Constant, 0, 3.14159265f );
+            }
+
+            for( const Function& function : functions )
+            {
+                if( std::strlen( function.name ) != identLength || std::strncmp( function.name, identStart, identLength ) != 0 )
+                {
+                    continue;
+                }
+
+                if( !Accept( '(' ) )
+                {
+                    return -2;
+                }
+
+                int args[3] = { -1, -1, -1 };
+
+                for( int i = 0; i < function.argCount; i++ )
+                {
+                    if( i > 0 && !Accept( ',' ) )
+                    {
+                        return -2;
+                    }
+                    args[i] = ParseExpression();
+
+                    if( args[i] < 0 )
+                    {
+                        return -2;
+                    }
+                }
+
+                if( !Accept( ')' ) )
+                {
+                    return -2;
+                }
+                return Emit( function.op, args[0], args[1], args[2] );
+            }
+            return -2;
+        }
+
+        const char* mCursor;
+        std::vector<Instruction>& mBytecode;
+        std::vector<Value> mValues;
+    };
+}
+
+bool FastNoise::Expression::SetExpression( const char* expression )
+{
+    std::vector<Instruction> bytecode;
+    uint8_t resultRegister;
+
+    if( !expression || !ExpressionCompiler<Instruction, Opcode>( expression, bytecode ).Compile( resultRegister ) )
+    {
+        return false;
+    }
+
+    mExpression = expression;
+    mBytecode = std::move( bytecode );
+    mResultRegister = resultRegister;
+    return true;
+}
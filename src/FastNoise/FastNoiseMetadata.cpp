@@ -27,6 +27,16 @@ FastNoise::NodeData::NodeData( const Metadata* data )
         {
             hybrids.emplace_back( nullptr, value.valueDefault );
         }
+
+        for( const auto& value : metadata->memberHybridLists )
+        {
+            hybridLists.emplace_back( value.countDefault, std::pair<NodeData*, float>( nullptr, value.valueDefault ) );
+        }
+
+        for( const auto& value : metadata->memberStrings )
+        {
+            strings.emplace_back( value.valueDefault );
+        }
     }
 }
 
@@ -57,7 +67,9 @@ bool FastNoise::Metadata::SerialiseNodeData( NodeData* nodeData, std::vector<uin
     if( !metadata ||
         nodeData->variables.size() != metadata->memberVariables.size() ||
         nodeData->nodes.size()     != metadata->memberNodes.size()     ||
-        nodeData->hybrids.size()   != metadata->memberHybrids.size()   )
+        nodeData->hybrids.size()   != metadata->memberHybrids.size()   ||
+        nodeData->hybridLists.size() != metadata->memberHybridLists.size() ||
+        nodeData->strings.size()   != metadata->memberStrings.size()   )
     {
         assert( 0 ); // Member size mismatch with metadata
         return false;
@@ -81,6 +93,16 @@ bool FastNoise::Metadata::SerialiseNodeData( NodeData* nodeData, std::vector<uin
                 hybrid.first = nullptr;
             }
         }
+        for( auto& hybridList : nodeData->hybridLists )
+        {
+            for( auto& hybrid : hybridList )
+            {
+                if( dependancies.find( hybrid.first ) != dependancies.end() )
+                {
+                    hybrid.first = nullptr;
+                }
+            }
+        }
     }
 
     AddToDataStream( dataStream, metadata->id );
@@ -142,6 +164,77 @@ bool FastNoise::Metadata::SerialiseNodeData( NodeData* nodeData, std::vector<uin
         }
     }
 
+    for( size_t i = 0; i < metadata->memberHybridLists.size(); i++ )
+    {
+        auto& hybridList = nodeData->hybridLists[i];
+        const auto& memberList = metadata->memberHybridLists[i];
+
+        if( hybridList.size() < memberList.countMin || hybridList.size() > memberList.countMax )
+        {
+            assert( 0 ); // List size outside what metadata allows
+            return false;
+        }
+
+        AddToDataStream( dataStream, (uint8_t)hybridList.size() );
+
+        for( size_t j = 0; j < hybridList.size(); j++ )
+        {
+            if( !hybridList[j].first )
+            {
+                AddToDataStream( dataStream, (uint8_t)0 );
+
+                Metadata::MemberVariable::ValueUnion v = hybridList[j].second;
+
+                AddToDataStream( dataStream, v.i );
+            }
+            else
+            {
+                if( fixUp )
+                {
+                    std::unique_ptr<Generator> gen( metadata->NodeFactory() );
+                    std::shared_ptr<Generator> node( hybridList[j].first->metadata->NodeFactory() );
+
+                    memberList.setCountFunc( gen.get(), hybridList.size() );
+                    if( !memberList.setNodeFunc( gen.get(), j, node ) )
+                    {
+                        hybridList[j].first = nullptr;
+                        return false;
+                    }
+                }
+
+                AddToDataStream( dataStream, (uint8_t)1 );
+                if( !SerialiseNodeData( hybridList[j].first, dataStream, fixUp, dependancies ) )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    for( size_t i = 0; i < metadata->memberStrings.size(); i++ )
+    {
+        const std::string& string = nodeData->strings[i];
+
+        if( string.size() > UINT16_MAX )
+        {
+            return false;
+        }
+
+        if( fixUp )
+        {
+            std::unique_ptr<Generator> gen( metadata->NodeFactory() );
+
+            if( !metadata->memberStrings[i].setFunc( gen.get(), string.c_str() ) )
+            {
+                return false;
+            }
+        }
+
+        AddToDataStream( dataStream, (uint16_t)string.size() );
+
+        dataStream.insert( dataStream.end(), string.begin(), string.end() );
+    }
+
     return true; 
 }
 
@@ -150,7 +243,11 @@ FastNoise::SmartNode<> FastNoise::Metadata::DeserialiseSmartNode( const char* se
     std::vector<uint8_t> dataStream = Base64::Decode( serialisedBase64NodeData );
     size_t startIdx = 0;
 
-    return DeserialiseSmartNode( dataStream, startIdx, level );
+    // Identical subtrees are encoded once per reference, share one node instance between them so
+    // IsSharedSource() sees them as shared, the same as a tree built in code that reuses a node
+    std::unordered_map<std::string, SmartNode<>> sharedNodes;
+
+    return DeserialiseSmartNode( dataStream, startIdx, level, sharedNodes );
 }
 
 template<typename T>
@@ -167,8 +264,24 @@ bool GetFromDataStream( const std::vector<uint8_t>& dataStream, size_t& idx, T&
     return true;
 }
 
-FastNoise::SmartNode<> FastNoise::Metadata::DeserialiseSmartNode( const std::vector<uint8_t>& serialisedNodeData, size_t& serialIdx, FastSIMD::eLevel level )
+bool GetStringFromDataStream( const std::vector<uint8_t>& dataStream, size_t& idx, std::string& value )
 {
+    uint16_t length;
+    if( !GetFromDataStream( dataStream, idx, length ) || dataStream.size() < idx + length )
+    {
+        return false;
+    }
+
+    value.assign( reinterpret_cast<const char*>( dataStream.data() + idx ), length );
+
+    idx += length;
+    return true;
+}
+
+FastNoise::SmartNode<> FastNoise::Metadata::DeserialiseSmartNode( const std::vector<uint8_t>& serialisedNodeData, size_t& serialIdx, FastSIMD::eLevel level, std::unordered_map<std::string, SmartNode<>>& sharedNodes )
+{
+    size_t startIdx = serialIdx;
+
     uint16_t nodeId;
     if( !GetFromDataStream( serialisedNodeData, serialIdx, nodeId ) )
     {
@@ -198,7 +311,7 @@ FastNoise::SmartNode<> FastNoise::Metadata::DeserialiseSmartNode( const std::vec
 
     for( const auto& node : metadata->memberNodes )
     {
-        SmartNode<> nodeGen = DeserialiseSmartNode( serialisedNodeData, serialIdx, level );
+        SmartNode<> nodeGen = DeserialiseSmartNode( serialisedNodeData, serialIdx, level, sharedNodes );
 
         if( !nodeGen || !node.setFunc( generator.get(), nodeGen ) )
         {
@@ -216,7 +329,7 @@ FastNoise::SmartNode<> FastNoise::Metadata::DeserialiseSmartNode( const std::vec
 
         if( isGenerator )
         {
-            SmartNode<> nodeGen = DeserialiseSmartNode( serialisedNodeData, serialIdx, level );
+            SmartNode<> nodeGen = DeserialiseSmartNode( serialisedNodeData, serialIdx, level, sharedNodes );
 
             if( !nodeGen || !hybrid.setNodeFunc( generator.get(), nodeGen ) )
             {
@@ -236,7 +349,61 @@ FastNoise::SmartNode<> FastNoise::Metadata::DeserialiseSmartNode( const std::vec
         }
     }
 
-    return generator;
+    for( const auto& hybridList : metadata->memberHybridLists )
+    {
+        uint8_t count;
+        if( !GetFromDataStream( serialisedNodeData, serialIdx, count ) || count < hybridList.countMin || count > hybridList.countMax )
+        {
+            return nullptr;
+        }
+
+        hybridList.setCountFunc( generator.get(), count );
+
+        for( size_t i = 0; i < count; i++ )
+        {
+            uint8_t isGenerator;
+            if( !GetFromDataStream( serialisedNodeData, serialIdx, isGenerator ) || isGenerator > 1 )
+            {
+                return nullptr;
+            }
+
+            if( isGenerator )
+            {
+                SmartNode<> nodeGen = DeserialiseSmartNode( serialisedNodeData, serialIdx, level, sharedNodes );
+
+                if( !nodeGen || !hybridList.setNodeFunc( generator.get(), i, nodeGen ) )
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                float v;
+
+                if( !GetFromDataStream( serialisedNodeData, serialIdx, v ) )
+                {
+                    return nullptr;
+                }
+
+                hybridList.setValueFunc( generator.get(), i, v );
+            }
+        }
+    }
+
+    for( const auto& string : metadata->memberStrings )
+    {
+        std::string value;
+
+        if( !GetStringFromDataStream( serialisedNodeData, serialIdx, value ) || !string.setFunc( generator.get(), value.c_str() ) )
+        {
+            return nullptr;
+        }
+    }
+
+    // The encoded bytes of a node cover its whole subtree, so equal bytes mean an identical subtree
+    std::string encoded( reinterpret_cast<const char*>( serialisedNodeData.data() + startIdx ), serialIdx - startIdx );
+
+    return sharedNodes.emplace( std::move( encoded ), std::move( generator ) ).first->second;
 }
 
 FastNoise::NodeData* FastNoise::Metadata::DeserialiseNodeData( const char* serialisedBase64NodeData, std::vector<std::unique_ptr<NodeData>>& nodeDataOut )
@@ -308,6 +475,53 @@ FastNoise::NodeData* FastNoise::Metadata::DeserialiseNodeData( const std::vector
         }
     }
 
+    for( size_t i = 0; i < nodeData->hybridLists.size(); i++ )
+    {
+        auto& hybridList = nodeData->hybridLists[i];
+
+        uint8_t count;
+        if( !GetFromDataStream( serialisedNodeData, serialIdx, count ) || count < metadata->memberHybridLists[i].countMin || count > metadata->memberHybridLists[i].countMax )
+        {
+            return nullptr;
+        }
+
+        hybridList.assign( count, { nullptr, metadata->memberHybridLists[i].valueDefault } );
+
+        for( auto& hybrid : hybridList )
+        {
+            uint8_t isGenerator;
+            if( !GetFromDataStream( serialisedNodeData, serialIdx, isGenerator ) || isGenerator > 1 )
+            {
+                return nullptr;
+            }
+
+            if( isGenerator )
+            {
+                hybrid.first = DeserialiseNodeData( serialisedNodeData, nodeDataOut, serialIdx );
+
+                if( !hybrid.first )
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                if( !GetFromDataStream( serialisedNodeData, serialIdx, hybrid.second ) )
+                {
+                    return nullptr;
+                }
+            }
+        }
+    }
+
+    for( auto& string : nodeData->strings )
+    {
+        if( !GetStringFromDataStream( serialisedNodeData, serialIdx, string ) )
+        {
+            return nullptr;
+        }
+    }
+
     auto find = std::find_if( nodeDataOut.begin(), nodeDataOut.end(), [newNode = nodeData.get()]( const auto& existingNode )
     {
         return *newNode == *existingNode;
@@ -0,0 +1,381 @@
+#include "FastNoise/GridExport.h"
+#include "FastNoise/GridStream.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    // Read/write mapping of a whole file
+    class MappedFile
+    {
+    public:
+        ~MappedFile() { Close(); }
+
+        // Opens or creates the file, existingSize receives its current size, 0 if it was created or truncated
+        bool Open( const char* path, bool truncate, uint64_t& existingSize )
+        {
+            existingSize = 0;
+#ifdef _WIN32
+            mFile = CreateFileA( path, GENERIC_READ | GENERIC_WRITE, 0, nullptr, truncate ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr );
+            if( mFile == INVALID_HANDLE_VALUE )
+            {
+                return false;
+            }
+
+            LARGE_INTEGER fileSize;
+            if( GetFileSizeEx( mFile, &fileSize ) )
+            {
+                existingSize = (uint64_t)fileSize.QuadPart;
+            }
+#else
+            mFile = open( path, O_RDWR | O_CREAT | ( truncate ? O_TRUNC : 0 ), 0644 );
+            if( mFile < 0 )
+            {
+                return false;
+            }
+
+            struct stat fileStat;
+            if( fstat( mFile, &fileStat ) == 0 )
+            {
+                existingSize = (uint64_t)fileStat.st_size;
+            }
+#endif
+            return true;
+        }
+
+        // Resizes the file to size and maps all of it
+        bool Map( uint64_t size )
+        {
+#ifdef _WIN32
+            mMapping = CreateFileMappingA( mFile, nullptr, PAGE_READWRITE, (DWORD)( size >> 32 ), (DWORD)size, nullptr );
+            if( !mMapping )
+            {
+                return false;
+            }
+
+            mData = static_cast<uint8_t*>( MapViewOfFile( mMapping, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T)size ) );
+#else
+            struct stat fileStat;
+            if( fstat( mFile, &fileStat ) != 0 || ( (uint64_t)fileStat.st_size != size && ftruncate( mFile, (off_t)size ) != 0 ) )
+            {
+                return false;
+            }
+
+            void* data = mmap( nullptr, (size_t)size, PROT_READ | PROT_WRITE, MAP_SHARED, mFile, 0 );
+            mData = data == MAP_FAILED ? nullptr : static_cast<uint8_t*>( data );
+#endif
+            mSize = size;
+            return mData != nullptr;
+        }
+
+        // Writes the range back to the file, with wait false the write is only started
+        // Waiting also flushes the file's metadata and the device cache so the data survives a crash
+        void Flush( uint64_t offset, uint64_t length, bool wait )
+        {
+#ifdef _WIN32
+            FlushViewOfFile( mData + offset, (SIZE_T)length );
+
+            if( wait )
+            {
+                FlushFileBuffers( mFile );
+            }
+#else
+            // msync requires a page aligned address
+            uint64_t pageSize = (uint64_t)sysconf( _SC_PAGESIZE );
+            uint64_t alignedOffset = offset / pageSize * pageSize;
+
+            msync( mData + alignedOffset, (size_t)( length + offset - alignedOffset ), wait ? MS_SYNC : MS_ASYNC );
+#endif
+        }
+
+        void Close()
+        {
+#ifdef _WIN32
+            if( mData )
+            {
+                UnmapViewOfFile( mData );
+            }
+            if( mMapping )
+            {
+                CloseHandle( mMapping );
+            }
+            if( mFile != INVALID_HANDLE_VALUE )
+            {
+                CloseHandle( mFile );
+            }
+            mMapping = nullptr;
+            mFile = INVALID_HANDLE_VALUE;
+#else
+            if( mData )
+            {
+                munmap( mData, (size_t)mSize );
+            }
+            if( mFile >= 0 )
+            {
+                close( mFile );
+            }
+            mFile = -1;
+#endif
+            mData = nullptr;
+        }
+
+        uint8_t* Data() const { return mData; }
+
+    private:
+#ifdef _WIN32
+        HANDLE mFile = INVALID_HANDLE_VALUE;
+        HANDLE mMapping = nullptr;
+#else
+        int mFile = -1;
+#endif
+        uint8_t* mData = nullptr;
+        uint64_t mSize = 0;
+    };
+
+    // Completed tiles are marked in batches of about this much tile data, each batch costs one sync of the data and one of the index
+    constexpr uint64_t kCommitBytes = 64ull << 20;
+
+    uint64_t AlignUp( uint64_t value, uint64_t alignment )
+    {
+        return ( value + alignment - 1 ) / alignment * alignment;
+    }
+
+    FastNoise::GridFileHeader BuildHeader( const FastNoise::GridExportSettings& settings )
+    {
+        FastNoise::GridFileHeader header;
+        memset( &header, 0, sizeof( header ) );
+
+        bool integerFormat = settings.format.type == FastNoise::OutputFormat::UInt8 ||
+                             settings.format.type == FastNoise::OutputFormat::UInt16 ||
+                             settings.format.type == FastNoise::OutputFormat::Int16;
+
+        header.magic = FastNoise::GridFileHeader::kMagic;
+        header.version = FastNoise::GridFileHeader::kVersion;
+        header.dimensions = (uint32_t)settings.dimensions;
+        header.tileSize = settings.tileSize;
+        header.frequency = settings.frequency;
+        header.seed = settings.seed;
+        header.formatType = (uint32_t)settings.format.type;
+        header.rangeMin = settings.format.rangeMin;
+        header.rangeMax = settings.format.rangeMax;
+        header.perTileRange = settings.perTileRange && integerFormat;
+        header.sourceHash = settings.sourceHash;
+
+        uint64_t tileCount = 1;
+        uint64_t tileSamples = 1;
+
+        for( int32_t i = 0; i < 3; i++ )
+        {
+            bool used = i < settings.dimensions;
+
+            header.start[i] = used ? settings.start[i] : 0;
+            header.size[i] = used ? settings.size[i] : 1;
+            header.tileCount[i] = used ? ( settings.size[i] + settings.tileSize - 1 ) / settings.tileSize : 1;
+
+            tileCount *= header.tileCount[i];
+            tileSamples *= used ? settings.tileSize : 1;
+        }
+
+        header.tileIndexOffset = AlignUp( sizeof( header ), 64 );
+        header.tileDataOffset = AlignUp( header.tileIndexOffset + tileCount * sizeof( FastNoise::GridFileTile ), 4096 );
+        header.tileBytes = AlignUp( tileSamples * settings.format.GetElementSize(), 64 );
+
+        return header;
+    }
+}
+
+bool FastNoise::ExportGrid( const Generator& generator, const char* path, const GridExportSettings& settings, GridExportResult* result )
+{
+    assert( settings.dimensions == 2 || settings.dimensions == 3 );
+    assert( settings.tileSize > 0 );
+
+    GridFileHeader header = BuildHeader( settings );
+
+    size_t tileCount = (size_t)header.tileCount[0] * header.tileCount[1] * header.tileCount[2];
+    uint64_t fileSize = header.tileDataOffset + tileCount * header.tileBytes;
+
+    MappedFile file;
+    uint64_t existingSize;
+
+    // Without a source hash there is no way to tell the existing tiles came from the same node tree
+    bool resume = settings.resume && settings.sourceHash != 0;
+
+    if( !file.Open( path, !resume, existingSize ) ||
+        ( existingSize != 0 && existingSize != fileSize ) ||
+        !file.Map( fileSize ) )
+    {
+        return false;
+    }
+
+    bool resumed = existingSize != 0;
+
+    if( resumed && memcmp( file.Data(), &header, sizeof( header ) ) != 0 )
+    {
+        return false;
+    }
+
+    if( !resumed )
+    {
+        // New file is zero filled, so no tiles are marked complete
+        memcpy( file.Data(), &header, sizeof( header ) );
+        file.Flush( 0, sizeof( header ), true );
+    }
+
+    GridFileTile* tiles = reinterpret_cast<GridFileTile*>( file.Data() + header.tileIndexOffset );
+
+    std::atomic<size_t> tilesGenerated( 0 );
+    std::atomic<size_t> tilesSkipped( 0 );
+
+    std::mutex pendingMutex;
+    std::vector<size_t> pendingTiles;
+    size_t commitTileCount = (size_t)std::max<uint64_t>( 1, kCommitBytes / header.tileBytes );
+
+    // Tile data must reach the file before its tile is marked complete for resume to be safe
+    // Syncing the whole data range also waits for tiles other threads are writing, they are not marked until their own batch
+    auto commitTiles = [&]( const std::vector<size_t>& batch )
+    {
+        file.Flush( header.tileDataOffset, tileCount * header.tileBytes, true );
+
+        for( size_t index : batch )
+        {
+            tiles[index].complete = 1;
+        }
+
+        file.Flush( header.tileIndexOffset, tileCount * sizeof( GridFileTile ), true );
+    };
+
+    int32_t tileSize = settings.tileSize;
+    size_t tileSamples = (size_t)tileSize * tileSize * ( settings.dimensions == 3 ? tileSize : 1 );
+
+    size_t elementSize = settings.format.GetElementSize();
+
+    // Edge tiles and quantised formats are generated into the buffer first, then copied or quantised into the tile one row at a time
+    Internal::ForEachGridTile( tileCount, tileSamples, settings.threadCount, [&]( size_t index, int32_t, float* buffer )
+    {
+        GridFileTile& tile = tiles[index];
+
+        if( tile.complete )
+        {
+            tilesSkipped++;
+            return OutputMinMax{ tile.min, tile.max };
+        }
+
+        int32_t tilePos[3] = {
+            (int32_t)( index % header.tileCount[0] ) * tileSize,
+            (int32_t)( index / header.tileCount[0] % header.tileCount[1] ) * tileSize,
+            (int32_t)( index / header.tileCount[0] / header.tileCount[1] ) * tileSize
+        };
+
+        // Only samples inside the grid are generated, so they alone make up the tile min/max and per tile range
+        int32_t extent[3];
+        for( int32_t i = 0; i < 3; i++ )
+        {
+            extent[i] = i < settings.dimensions ? std::min( tileSize, header.size[i] - tilePos[i] ) : 1;
+        }
+
+        uint64_t tileOffset = header.tileDataOffset + index * header.tileBytes;
+        uint8_t* tileData = file.Data() + tileOffset;
+
+        bool fullTile = extent[0] == tileSize && extent[1] == tileSize && ( settings.dimensions == 2 || extent[2] == tileSize );
+        bool directOut = fullTile && settings.format.type == OutputFormat::Float32;
+        float* floatOut = directOut ? reinterpret_cast<float*>( tileData ) : buffer;
+
+        // Stats output keeps the tile min/max independent of FASTNOISE_CALC_MIN_MAX
+        OutputStats stats;
+
+        if( settings.dimensions == 3 )
+        {
+            generator.GenUniformGrid3D( floatOut, stats, header.start[0] + tilePos[0], header.start[1] + tilePos[1], header.start[2] + tilePos[2],
+                extent[0], extent[1], extent[2], settings.frequency, settings.seed );
+        }
+        else
+        {
+            generator.GenUniformGrid2D( floatOut, stats, header.start[0] + tilePos[0], header.start[1] + tilePos[1],
+                extent[0], extent[1], settings.frequency, settings.seed );
+        }
+
+        OutputMinMax minMax = stats.minMax;
+
+        if( !directOut )
+        {
+            OutputFormat tileFormat = settings.format;
+
+            if( header.perTileRange )
+            {
+                tileFormat.rangeMin = minMax.min;
+                tileFormat.rangeMax = minMax.max;
+            }
+
+            // Full tiles are contiguous, edge tile rows keep the tileSize stride of the file layout
+            size_t rowLength = fullTile ? tileSamples : (size_t)extent[0];
+            size_t rowCount = fullTile ? 1 : (size_t)extent[1] * extent[2];
+
+            for( size_t row = 0; row < rowCount; row++ )
+            {
+                size_t y = row % extent[1], z = row / extent[1];
+                uint8_t* rowOut = tileData + ( z * tileSize + y ) * tileSize * elementSize;
+                const float* rowIn = buffer + row * rowLength;
+
+                if( tileFormat.type == OutputFormat::Float32 )
+                {
+                    memcpy( rowOut, rowIn, rowLength * sizeof( float ) );
+                }
+                else
+                {
+                    generator.QuantiseToFormat( rowOut, tileFormat, rowIn, rowLength );
+                }
+            }
+        }
+
+        file.Flush( tileOffset, header.tileBytes, false );
+
+        tile.min = minMax.min;
+        tile.max = minMax.max;
+
+        std::vector<size_t> batch;
+        {
+            std::lock_guard<std::mutex> lock( pendingMutex );
+            pendingTiles.push_back( index );
+
+            if( pendingTiles.size() >= commitTileCount )
+            {
+                batch.swap( pendingTiles );
+            }
+        }
+
+        if( !batch.empty() )
+        {
+            commitTiles( batch );
+        }
+
+        tilesGenerated++;
+        return minMax;
+    } );
+
+    if( !pendingTiles.empty() )
+    {
+        commitTiles( pendingTiles );
+    }
+
+    if( result )
+    {
+        result->tilesGenerated = tilesGenerated;
+        result->tilesSkipped = tilesSkipped;
+    }
+    return true;
+}
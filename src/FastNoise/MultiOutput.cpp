@@ -0,0 +1,53 @@
+#include "FastNoise/Generators/MultiOutput.h"
+
+#include <cctype>
+#include <cstring>
+
+bool FastNoise::MultiOutput::SetOutputNames( const char* names )
+{
+    if( !names )
+    {
+        return false;
+    }
+
+    std::vector<std::string> parsed;
+    const char* cursor = names;
+
+    while( *cursor != '\0' )
+    {
+        const char* end = cursor;
+        while( *end != '\0' && *end != ',' )
+        {
+            end++;
+        }
+
+        const char* trimStart = cursor;
+        const char* trimEnd = end;
+        while( trimStart < trimEnd && std::isspace( (unsigned char)*trimStart ) )
+        {
+            trimStart++;
+        }
+        while( trimEnd > trimStart && std::isspace( (unsigned char)trimEnd[-1] ) )
+        {
+            trimEnd--;
+        }
+
+        parsed.emplace_back( trimStart, trimEnd );
+        cursor = *end == ',' ? end + 1 : end;
+    }
+
+    mOutputNames = std::move( parsed );
+    return true;
+}
+
+int FastNoise::MultiOutput::GetOutputIndex( const char* name ) const
+{
+    for( size_t i = 0; i < mOutputNames.size() && i < mOutputs.size(); i++ )
+    {
+        if( !mOutputNames[i].empty() && std::strcmp( mOutputNames[i].c_str(), name ) == 0 )
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,52 @@
+#include "FastNoise/SparseVolume.h"
+
+#include <cassert>
+
+void FastNoise::SparseVolume::Reset( int32_t brickSize, int32_t xSize, int32_t ySize, int32_t zSize )
+{
+    assert( brickSize > 0 && xSize % brickSize == 0 && ySize % brickSize == 0 && zSize % brickSize == 0 );
+
+    mBrickSize = brickSize;
+    mXBricks = xSize / brickSize;
+    mYBricks = ySize / brickSize;
+    mZBricks = zSize / brickSize;
+
+    mBricks.clear();
+    mBricks.reserve( (size_t)mXBricks * mYBricks * mZBricks );
+    mDenseValues.clear();
+}
+
+const float* FastNoise::SparseVolume::GetBrickValues( size_t brickIndex ) const
+{
+    const Brick& brick = mBricks[brickIndex];
+
+    if( brick.denseOffset == kUniform )
+    {
+        return nullptr;
+    }
+    return mDenseValues.data() + brick.denseOffset;
+}
+
+float FastNoise::SparseVolume::GetValue( int32_t x, int32_t y, int32_t z ) const
+{
+    const Brick& brick = mBricks[GetBrickIndex( x / mBrickSize, y / mBrickSize, z / mBrickSize )];
+
+    if( brick.denseOffset == kUniform )
+    {
+        return brick.constant;
+    }
+
+    size_t local = ( (size_t)( z % mBrickSize ) * mBrickSize + y % mBrickSize ) * mBrickSize + x % mBrickSize;
+    return mDenseValues[brick.denseOffset + local];
+}
+
+void FastNoise::SparseVolume::AddUniformBrick( float constant )
+{
+    mBricks.push_back( { kUniform, constant } );
+}
+
+void FastNoise::SparseVolume::AddDenseBrick( const float* values )
+{
+    mBricks.push_back( { mDenseValues.size(), 0.0f } );
+    mDenseValues.insert( mDenseValues.end(), values, values + BrickVolume() );
+}
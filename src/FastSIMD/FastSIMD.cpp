@@ -153,6 +153,9 @@ FastSIMD::eLevel FastSIMD::CPUMaxSIMDLevel()
     simdLevel = Level_AVX;
     // 7: AVX supported
 
+    if ( (abcd[2] & (1 << 29)) == 0 )
+        return simdLevel; // no F16C
+
     cpuid( abcd, 7 ); // call cpuid leaf 7 for feature flags
     if ( (abcd[1] & (1 << 5)) == 0 )
         return simdLevel; // no AVX2
@@ -175,6 +175,68 @@ namespace FastSIMD
             return _mm256_loadu_si256( reinterpret_cast<__m256i const*>(p) );
         }
 
+        FS_INLINE static float32v Gather_f32( void const* p, int32v a )
+        {
+            return _mm256_i32gather_ps( reinterpret_cast<float const*>(p), a, 4 );
+        }
+
+        FS_INLINE static void LoadTransposed2_f32( void const* p, size_t stride, float32v& x, float32v& y )
+        {
+            char const* c = reinterpret_cast<char const*>(p);
+
+            auto loadPair = [c, stride]( size_t i )
+            {
+                return _mm_loadh_pi( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(c + stride * i) ), reinterpret_cast<__m64 const*>(c + stride * (i + 1)) );
+            };
+
+            // Low 128 lane holds elements 0-3, high lane 4-7
+            __m256 p0145 = _mm256_insertf128_ps( _mm256_castps128_ps256( loadPair( 0 ) ), loadPair( 4 ), 1 );
+            __m256 p2367 = _mm256_insertf128_ps( _mm256_castps128_ps256( loadPair( 2 ) ), loadPair( 6 ), 1 );
+
+            x = _mm256_shuffle_ps( p0145, p2367, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            y = _mm256_shuffle_ps( p0145, p2367, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+        }
+
+        FS_INLINE static void LoadTransposed3_f32( void const* p, size_t stride, float32v& x, float32v& y, float32v& z )
+        {
+            char const* c = reinterpret_cast<char const*>(p);
+
+            auto loadPoints = [c, stride]( size_t i )
+            {
+                auto loadPoint = [c, stride]( size_t i )
+                {
+                    char const* point = c + stride * i;
+                    return _mm_movelh_ps( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(point) ), _mm_load_ss( reinterpret_cast<float const*>(point + 8) ) );
+                };
+
+                return _mm256_insertf128_ps( _mm256_castps128_ps256( loadPoint( i ) ), loadPoint( i + 4 ), 1 );
+            };
+
+            __m256 p0 = loadPoints( 0 );
+            __m256 p1 = loadPoints( 1 );
+            __m256 p2 = loadPoints( 2 );
+            __m256 p3 = loadPoints( 3 );
+
+            __m256 xy01 = _mm256_unpacklo_ps( p0, p1 );
+            __m256 xy23 = _mm256_unpacklo_ps( p2, p3 );
+            __m256 z01 = _mm256_unpackhi_ps( p0, p1 );
+            __m256 z23 = _mm256_unpackhi_ps( p2, p3 );
+
+            x = _mm256_shuffle_ps( xy01, xy23, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+            y = _mm256_shuffle_ps( xy01, xy23, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+            z = _mm256_shuffle_ps( z01, z23, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        }
+
+        FS_INLINE static float32v MaskedLoad_f32( void const* p, mask32v m )
+        {
+            return _mm256_maskload_ps( reinterpret_cast<float const*>(p), m );
+        }
+
+        FS_INLINE static int32v MaskedLoad_i32( void const* p, mask32v m )
+        {
+            return _mm256_maskload_epi32( reinterpret_cast<int const*>(p), m );
+        }
+
         // Store
 
         FS_INLINE static void Store_f32( void* p, float32v a )
@@ -187,6 +249,52 @@ namespace FastSIMD
             _mm256_storeu_si256( reinterpret_cast<__m256i*>(p), a );
         }
 
+        FS_INLINE static void MaskedStore_f32( void* p, float32v a, mask32v m )
+        {
+            _mm256_maskstore_ps( reinterpret_cast<float*>(p), m, a );
+        }
+
+        FS_INLINE static void StoreNonTemporal_f32( void* p, float32v a )
+        {
+            _mm256_stream_ps( reinterpret_cast<float*>(p), a );
+        }
+
+        FS_INLINE static void StoreFence()
+        {
+            _mm_sfence();
+        }
+
+        FS_INLINE static float Extract0_f32( float32v a )
+        {
+            return _mm256_cvtss_f32( a );
+        }
+
+        FS_INLINE static uint32_t MoveMask_m32( mask32v m )
+        {
+            return (uint32_t)_mm256_movemask_ps( _mm256_castsi256_ps( m ) );
+        }
+
+        FS_INLINE static void StorePacked_u8( void* p, int32v a )
+        {
+            __m128i packed = _mm_packs_epi32( _mm256_castsi256_si128( a ), _mm256_extracti128_si256( a, 1 ) );
+            _mm_storel_epi64( reinterpret_cast<__m128i*>(p), _mm_packus_epi16( packed, packed ) );
+        }
+
+        FS_INLINE static void StorePacked_u16( void* p, int32v a )
+        {
+            _mm_storeu_si128( reinterpret_cast<__m128i*>(p), _mm_packus_epi32( _mm256_castsi256_si128( a ), _mm256_extracti128_si256( a, 1 ) ) );
+        }
+
+        FS_INLINE static void StorePacked_i16( void* p, int32v a )
+        {
+            _mm_storeu_si128( reinterpret_cast<__m128i*>(p), _mm_packs_epi32( _mm256_castsi256_si128( a ), _mm256_extracti128_si256( a, 1 ) ) );
+        }
+
+        FS_INLINE static void StorePacked_f16( void* p, float32v a )
+        {
+            _mm_storeu_si128( reinterpret_cast<__m128i*>(p), _mm256_cvtps_ph( a, _MM_FROUND_TO_NEAREST_INT ) );
+        }
+
         // Cast
 
         FS_INLINE static float32v Casti32_f32( int32v a )
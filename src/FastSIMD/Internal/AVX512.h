@@ -176,6 +176,79 @@ namespace FastSIMD
             return _mm512_loadu_si512( p );
         }
 
+        FS_INLINE static float32v Gather_f32( void const* p, int32v a )
+        {
+            return _mm512_i32gather_ps( a, p, 4 );
+        }
+
+        FS_INLINE static void LoadTransposed2_f32( void const* p, size_t stride, float32v& x, float32v& y )
+        {
+            char const* c = reinterpret_cast<char const*>(p);
+
+            auto loadPair = [c, stride]( size_t i )
+            {
+                return _mm_loadh_pi( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(c + stride * i) ), reinterpret_cast<__m64 const*>(c + stride * (i + 1)) );
+            };
+
+            // 128 lane n holds elements 4n to 4n+3
+            auto loadPairs = [&loadPair]( size_t i )
+            {
+                __m512 v = _mm512_castps128_ps512( loadPair( i ) );
+                v = _mm512_insertf32x4( v, loadPair( i + 4 ), 1 );
+                v = _mm512_insertf32x4( v, loadPair( i + 8 ), 2 );
+                return _mm512_insertf32x4( v, loadPair( i + 12 ), 3 );
+            };
+
+            __m512 p01 = loadPairs( 0 );
+            __m512 p23 = loadPairs( 2 );
+
+            x = _mm512_shuffle_ps( p01, p23, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            y = _mm512_shuffle_ps( p01, p23, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+        }
+
+        FS_INLINE static void LoadTransposed3_f32( void const* p, size_t stride, float32v& x, float32v& y, float32v& z )
+        {
+            char const* c = reinterpret_cast<char const*>(p);
+
+            auto loadPoint = [c, stride]( size_t i )
+            {
+                char const* point = c + stride * i;
+                return _mm_movelh_ps( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(point) ), _mm_load_ss( reinterpret_cast<float const*>(point + 8) ) );
+            };
+
+            auto loadPoints = [&loadPoint]( size_t i )
+            {
+                __m512 v = _mm512_castps128_ps512( loadPoint( i ) );
+                v = _mm512_insertf32x4( v, loadPoint( i + 4 ), 1 );
+                v = _mm512_insertf32x4( v, loadPoint( i + 8 ), 2 );
+                return _mm512_insertf32x4( v, loadPoint( i + 12 ), 3 );
+            };
+
+            __m512 p0 = loadPoints( 0 );
+            __m512 p1 = loadPoints( 1 );
+            __m512 p2 = loadPoints( 2 );
+            __m512 p3 = loadPoints( 3 );
+
+            __m512 xy01 = _mm512_unpacklo_ps( p0, p1 );
+            __m512 xy23 = _mm512_unpacklo_ps( p2, p3 );
+            __m512 z01 = _mm512_unpackhi_ps( p0, p1 );
+            __m512 z23 = _mm512_unpackhi_ps( p2, p3 );
+
+            x = _mm512_shuffle_ps( xy01, xy23, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+            y = _mm512_shuffle_ps( xy01, xy23, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+            z = _mm512_shuffle_ps( z01, z23, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+        }
+
+        FS_INLINE static float32v MaskedLoad_f32( void const* p, mask32v m )
+        {
+            return _mm512_maskz_loadu_ps( m, p );
+        }
+
+        FS_INLINE static int32v MaskedLoad_i32( void const* p, mask32v m )
+        {
+            return _mm512_maskz_loadu_epi32( m, p );
+        }
+
         // Store
 
         FS_INLINE static void Store_f32( void* p, float32v a )
@@ -188,6 +261,51 @@ namespace FastSIMD
             _mm512_storeu_si512( p, a );
         }
 
+        FS_INLINE static void MaskedStore_f32( void* p, float32v a, mask32v m )
+        {
+            _mm512_mask_storeu_ps( p, m, a );
+        }
+
+        FS_INLINE static void StoreNonTemporal_f32( void* p, float32v a )
+        {
+            _mm512_stream_ps( reinterpret_cast<float*>(p), a );
+        }
+
+        FS_INLINE static void StoreFence()
+        {
+            _mm_sfence();
+        }
+
+        FS_INLINE static float Extract0_f32( float32v a )
+        {
+            return _mm512_cvtss_f32( a );
+        }
+
+        FS_INLINE static uint32_t MoveMask_m32( mask32v m )
+        {
+            return m;
+        }
+
+        FS_INLINE static void StorePacked_u8( void* p, int32v a )
+        {
+            _mm_storeu_si128( reinterpret_cast<__m128i*>(p), _mm512_cvtusepi32_epi8( _mm512_max_epi32( a, _mm512_setzero_si512() ) ) );
+        }
+
+        FS_INLINE static void StorePacked_u16( void* p, int32v a )
+        {
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>(p), _mm512_cvtusepi32_epi16( _mm512_max_epi32( a, _mm512_setzero_si512() ) ) );
+        }
+
+        FS_INLINE static void StorePacked_i16( void* p, int32v a )
+        {
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>(p), _mm512_cvtsepi32_epi16( a ) );
+        }
+
+        FS_INLINE static void StorePacked_f16( void* p, float32v a )
+        {
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>(p), _mm512_cvtps_ph( a, _MM_FROUND_TO_NEAREST_INT ) );
+        }
+
         // Cast
 
         FS_INLINE static float32v Casti32_f32( int32v a )
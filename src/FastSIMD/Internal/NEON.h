@@ -191,6 +191,67 @@ public:
         return vld1q_s32( reinterpret_cast<int32_t const*>(p) );
     }
 
+    FS_INLINE static float32v Gather_f32( void const* p, int32v a )
+    {
+        alignas(16) int32_t idx[4];
+        vst1q_s32( idx, a );
+
+        float const* f = reinterpret_cast<float const*>(p);
+        return float32v( f[idx[0]], f[idx[1]], f[idx[2]], f[idx[3]] );
+    }
+
+    FS_INLINE static void LoadTransposed2_f32( void const* p, size_t stride, float32v& x, float32v& y )
+    {
+        char const* c = reinterpret_cast<char const*>(p);
+
+        // x0 y0 x1 y1, x2 y2 x3 y3
+        float32x4_t p01 = vcombine_f32( vld1_f32( reinterpret_cast<float const*>(c) ), vld1_f32( reinterpret_cast<float const*>(c + stride) ) );
+        float32x4_t p23 = vcombine_f32( vld1_f32( reinterpret_cast<float const*>(c + stride * 2) ), vld1_f32( reinterpret_cast<float const*>(c + stride * 3) ) );
+
+        float32x4x2_t xy = vuzpq_f32( p01, p23 );
+        x = xy.val[0];
+        y = xy.val[1];
+    }
+
+    FS_INLINE static void LoadTransposed3_f32( void const* p, size_t stride, float32v& x, float32v& y, float32v& z )
+    {
+        char const* c = reinterpret_cast<char const*>(p);
+
+        alignas(16) float xs[4];
+        alignas(16) float ys[4];
+        alignas(16) float zs[4];
+
+        for( size_t i = 0; i < 4; i++ )
+        {
+            float const* point = reinterpret_cast<float const*>(c + stride * i);
+            xs[i] = point[0];
+            ys[i] = point[1];
+            zs[i] = point[2];
+        }
+
+        x = vld1q_f32( xs );
+        y = vld1q_f32( ys );
+        z = vld1q_f32( zs );
+    }
+
+    FS_INLINE static float32v MaskedLoad_f32( void const* p, mask32v m )
+    {
+        alignas(16) int32_t mask[4];
+        vst1q_s32( mask, m );
+
+        float const* f = reinterpret_cast<float const*>(p);
+        return float32v( mask[0] ? f[0] : 0.0f, mask[1] ? f[1] : 0.0f, mask[2] ? f[2] : 0.0f, mask[3] ? f[3] : 0.0f );
+    }
+
+    FS_INLINE static int32v MaskedLoad_i32( void const* p, mask32v m )
+    {
+        alignas(16) int32_t mask[4];
+        vst1q_s32( mask, m );
+
+        int32_t const* i = reinterpret_cast<int32_t const*>(p);
+        return int32v( mask[0] ? i[0] : 0, mask[1] ? i[1] : 0, mask[2] ? i[2] : 0, mask[3] ? i[3] : 0 );
+    }
+
     // Store
 
     FS_INLINE static void Store_f32( void* p, float32v a )
@@ -203,6 +264,67 @@ public:
         vst1q_s32( reinterpret_cast<int32_t*>(p), a );
     }
 
+    FS_INLINE static void MaskedStore_f32( void* p, float32v a, mask32v m )
+    {
+        alignas(16) int32_t mask[4];
+        alignas(16) float values[4];
+        vst1q_s32( mask, m );
+        vst1q_f32( values, a );
+
+        float* f = reinterpret_cast<float*>(p);
+        for( int i = 0; i < 4; i++ )
+        {
+            if( mask[i] )
+            {
+                f[i] = values[i];
+            }
+        }
+    }
+
+    // No portable streaming store intrinsic, plain stores need no fence
+    FS_INLINE static void StoreNonTemporal_f32( void* p, float32v a )
+    {
+        vst1q_f32( reinterpret_cast<float*>(p), a );
+    }
+
+    FS_INLINE static void StoreFence() {}
+
+    FS_INLINE static float Extract0_f32( float32v a )
+    {
+        return vgetq_lane_f32( a, 0 );
+    }
+
+    FS_INLINE static uint32_t MoveMask_m32( mask32v m )
+    {
+        alignas(16) const int32_t bits[4]{ 1, 2, 4, 8 };
+        int32x4_t lanes = vandq_s32( m, vld1q_s32( bits ) );
+        int32x2_t pairs = vorr_s32( vget_low_s32( lanes ), vget_high_s32( lanes ) );
+
+        return (uint32_t)(vget_lane_s32( pairs, 0 ) | vget_lane_s32( pairs, 1 ));
+    }
+
+    FS_INLINE static void StorePacked_u8( void* p, int32v a )
+    {
+        uint16x4_t narrow = vqmovun_s32( a );
+        uint8x8_t packed = vqmovn_u16( vcombine_u16( narrow, narrow ) );
+        *reinterpret_cast<int32_t*>(p) = vget_lane_s32( vreinterpret_s32_u8( packed ), 0 );
+    }
+
+    FS_INLINE static void StorePacked_u16( void* p, int32v a )
+    {
+        vst1_u16( reinterpret_cast<uint16_t*>(p), vqmovun_s32( a ) );
+    }
+
+    FS_INLINE static void StorePacked_i16( void* p, int32v a )
+    {
+        vst1_s16( reinterpret_cast<int16_t*>(p), vqmovn_s32( a ) );
+    }
+
+    FS_INLINE static void StorePacked_f16( void* p, float32v a )
+    {
+        vst1_u16( reinterpret_cast<uint16_t*>(p), vreinterpret_u16_f16( vcvt_f16_f32( a ) ) );
+    }
+
     // Cast
 
     FS_INLINE static float32v Casti32_f32( int32v a )
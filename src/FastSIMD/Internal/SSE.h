@@ -186,6 +186,70 @@ namespace FastSIMD
             return _mm_loadu_si128( reinterpret_cast<__m128i const*>(p) );
         }
 
+        FS_INLINE static float32v Gather_f32( void const* p, int32v a )
+        {
+            alignas(16) int32_t idx[4];
+            _mm_store_si128( reinterpret_cast<__m128i*>(idx), a );
+
+            float const* f = reinterpret_cast<float const*>(p);
+            return _mm_setr_ps( f[idx[0]], f[idx[1]], f[idx[2]], f[idx[3]] );
+        }
+
+        FS_INLINE static void LoadTransposed2_f32( void const* p, size_t stride, float32v& x, float32v& y )
+        {
+            char const* c = reinterpret_cast<char const*>(p);
+
+            // x0 y0 x1 y1, x2 y2 x3 y3
+            __m128 p01 = _mm_loadh_pi( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(c) ), reinterpret_cast<__m64 const*>(c + stride) );
+            __m128 p23 = _mm_loadh_pi( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(c + stride * 2) ), reinterpret_cast<__m64 const*>(c + stride * 3) );
+
+            x = _mm_shuffle_ps( p01, p23, _MM_SHUFFLE( 2, 0, 2, 0 ) );
+            y = _mm_shuffle_ps( p01, p23, _MM_SHUFFLE( 3, 1, 3, 1 ) );
+        }
+
+        FS_INLINE static void LoadTransposed3_f32( void const* p, size_t stride, float32v& x, float32v& y, float32v& z )
+        {
+            char const* c = reinterpret_cast<char const*>(p);
+
+            auto loadPoint = [c, stride]( size_t i )
+            {
+                char const* point = c + stride * i;
+                return _mm_movelh_ps( _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<__m64 const*>(point) ), _mm_load_ss( reinterpret_cast<float const*>(point + 8) ) );
+            };
+
+            __m128 p0 = loadPoint( 0 );
+            __m128 p1 = loadPoint( 1 );
+            __m128 p2 = loadPoint( 2 );
+            __m128 p3 = loadPoint( 3 );
+
+            __m128 xy01 = _mm_unpacklo_ps( p0, p1 );
+            __m128 xy23 = _mm_unpacklo_ps( p2, p3 );
+            __m128 z01 = _mm_unpackhi_ps( p0, p1 );
+            __m128 z23 = _mm_unpackhi_ps( p2, p3 );
+
+            x = _mm_movelh_ps( xy01, xy23 );
+            y = _mm_movehl_ps( xy23, xy01 );
+            z = _mm_movelh_ps( z01, z23 );
+        }
+
+        FS_INLINE static float32v MaskedLoad_f32( void const* p, mask32v m )
+        {
+            alignas(16) int32_t mask[4];
+            _mm_store_si128( reinterpret_cast<__m128i*>(mask), m );
+
+            float const* f = reinterpret_cast<float const*>(p);
+            return _mm_setr_ps( mask[0] ? f[0] : 0.0f, mask[1] ? f[1] : 0.0f, mask[2] ? f[2] : 0.0f, mask[3] ? f[3] : 0.0f );
+        }
+
+        FS_INLINE static int32v MaskedLoad_i32( void const* p, mask32v m )
+        {
+            alignas(16) int32_t mask[4];
+            _mm_store_si128( reinterpret_cast<__m128i*>(mask), m );
+
+            int32_t const* i = reinterpret_cast<int32_t const*>(p);
+            return _mm_setr_epi32( mask[0] ? i[0] : 0, mask[1] ? i[1] : 0, mask[2] ? i[2] : 0, mask[3] ? i[3] : 0 );
+        }
+
         // Store
 
         FS_INLINE static void Store_f32( void* p, float32v a )
@@ -198,6 +262,100 @@ namespace FastSIMD
             _mm_storeu_si128( reinterpret_cast<__m128i*>(p), a );
         }
 
+        FS_INLINE static void MaskedStore_f32( void* p, float32v a, mask32v m )
+        {
+            alignas(16) int32_t mask[4];
+            alignas(16) float values[4];
+            _mm_store_si128( reinterpret_cast<__m128i*>(mask), m );
+            _mm_store_ps( values, a );
+
+            float* f = reinterpret_cast<float*>(p);
+            for( int i = 0; i < 4; i++ )
+            {
+                if( mask[i] )
+                {
+                    f[i] = values[i];
+                }
+            }
+        }
+
+        FS_INLINE static void StoreNonTemporal_f32( void* p, float32v a )
+        {
+            _mm_stream_ps( reinterpret_cast<float*>(p), a );
+        }
+
+        FS_INLINE static void StoreFence()
+        {
+            _mm_sfence();
+        }
+
+        FS_INLINE static float Extract0_f32( float32v a )
+        {
+            return _mm_cvtss_f32( a );
+        }
+
+        FS_INLINE static uint32_t MoveMask_m32( mask32v m )
+        {
+            return (uint32_t)_mm_movemask_ps( _mm_castsi128_ps( m ) );
+        }
+
+        FS_INLINE static void StorePacked_u8( void* p, int32v a )
+        {
+            __m128i packed = _mm_packus_epi16( _mm_packs_epi32( a, a ), _mm_setzero_si128() );
+            *reinterpret_cast<int32_t*>(p) = _mm_cvtsi128_si32( packed );
+        }
+
+        template<eLevel L = LEVEL_T, std::enable_if_t<(L < Level_SSE41)>* = nullptr>
+        FS_INLINE static void StorePacked_u16( void* p, int32v a )
+        {
+            // No unsigned 32 -> 16 pack before SSE4.1, clamp negatives to 0, bias into signed range and flip the top bit back
+            __m128i positive = _mm_andnot_si128( _mm_srai_epi32( a, 31 ), a );
+            __m128i biased = _mm_sub_epi32( positive, _mm_set1_epi32( 32768 ) );
+            _mm_storel_epi64( reinterpret_cast<__m128i*>(p), _mm_xor_si128( _mm_packs_epi32( biased, biased ), _mm_set1_epi16( -32768 ) ) );
+        }
+
+        template<eLevel L = LEVEL_T, std::enable_if_t<(L >= Level_SSE41)>* = nullptr>
+        FS_INLINE static void StorePacked_u16( void* p, int32v a )
+        {
+            _mm_storel_epi64( reinterpret_cast<__m128i*>(p), _mm_packus_epi32( a, a ) );
+        }
+
+        FS_INLINE static void StorePacked_i16( void* p, int32v a )
+        {
+            _mm_storel_epi64( reinterpret_cast<__m128i*>(p), _mm_packs_epi32( a, a ) );
+        }
+
+        FS_INLINE static void StorePacked_f16( void* p, float32v a )
+        {
+            const __m128i denormMagic = _mm_set1_epi32( ((127 - 15) + (23 - 10) + 1) << 23 );
+
+            __m128i f = _mm_castps_si128( a );
+            __m128i sign = _mm_and_si128( f, _mm_set1_epi32( 0x80000000 ) );
+            f = _mm_xor_si128( f, sign );
+
+            // Inf, NaN or out of range
+            __m128i isNaN = _mm_cmpgt_epi32( f, _mm_set1_epi32( 0x7F800000 ) );
+            __m128i nanHalf = _mm_or_si128( _mm_set1_epi32( 0x7E00 ), _mm_and_si128( _mm_srli_epi32( f, 13 ), _mm_set1_epi32( 0x3FF ) ) );
+            __m128i infHalf = _mm_or_si128( _mm_and_si128( isNaN, nanHalf ), _mm_andnot_si128( isNaN, _mm_set1_epi32( 0x7C00 ) ) );
+
+            // Denormal or zero
+            __m128i denormHalf = _mm_sub_epi32( _mm_castps_si128( _mm_add_ps( _mm_castsi128_ps( f ), _mm_castsi128_ps( denormMagic ) ) ), denormMagic );
+
+            // Normal, round to nearest even
+            __m128i mantissaOdd = _mm_and_si128( _mm_srli_epi32( f, 13 ), _mm_set1_epi32( 1 ) );
+            __m128i normalHalf = _mm_add_epi32( f, _mm_set1_epi32( (int32_t)((uint32_t)(15 - 127) << 23) + 0xFFF ) );
+            normalHalf = _mm_srli_epi32( _mm_add_epi32( normalHalf, mantissaOdd ), 13 );
+
+            __m128i isDenorm = _mm_cmplt_epi32( f, _mm_set1_epi32( 113 << 23 ) );
+            __m128i isInf = _mm_cmpgt_epi32( f, _mm_set1_epi32( ((127 + 16) << 23) - 1 ) );
+
+            __m128i half = _mm_or_si128( _mm_and_si128( isDenorm, denormHalf ), _mm_andnot_si128( isDenorm, normalHalf ) );
+            half = _mm_or_si128( _mm_and_si128( isInf, infHalf ), _mm_andnot_si128( isInf, half ) );
+            half = _mm_or_si128( half, _mm_srli_epi32( sign, 16 ) );
+
+            StorePacked_u16( p, half );
+        }
+
         // Cast
 
         FS_INLINE static float32v Casti32_f32( int32v a )
@@ -138,6 +138,36 @@ namespace FastSIMD
             return *reinterpret_cast<int32v const*>(p);
         }
 
+        FS_INLINE static float32v Gather_f32( void const* p, int32v a )
+        {
+            return reinterpret_cast<float const*>(p)[a];
+        }
+
+        FS_INLINE static void LoadTransposed2_f32( void const* p, size_t stride, float32v& x, float32v& y )
+        {
+            float const* f = reinterpret_cast<float const*>(p);
+            x = f[0];
+            y = f[1];
+        }
+
+        FS_INLINE static void LoadTransposed3_f32( void const* p, size_t stride, float32v& x, float32v& y, float32v& z )
+        {
+            float const* f = reinterpret_cast<float const*>(p);
+            x = f[0];
+            y = f[1];
+            z = f[2];
+        }
+
+        FS_INLINE static float32v MaskedLoad_f32( void const* p, mask32v m )
+        {
+            return m ? *reinterpret_cast<float32v const*>(p) : float32v( 0 );
+        }
+
+        FS_INLINE static int32v MaskedLoad_i32( void const* p, mask32v m )
+        {
+            return m ? *reinterpret_cast<int32v const*>(p) : int32v( 0 );
+        }
+
         // Store
 
         FS_INLINE static void Store_f32( void* p, float32v a )
@@ -150,6 +180,80 @@ namespace FastSIMD
             *reinterpret_cast<int32v*>(p) = a;
         }
 
+        FS_INLINE static void MaskedStore_f32( void* p, float32v a, mask32v m )
+        {
+            if( m )
+            {
+                *reinterpret_cast<float32v*>(p) = a;
+            }
+        }
+
+        FS_INLINE static void StoreNonTemporal_f32( void* p, float32v a )
+        {
+            *reinterpret_cast<float32v*>(p) = a;
+        }
+
+        FS_INLINE static void StoreFence() {}
+
+        FS_INLINE static float Extract0_f32( float32v a )
+        {
+            return a;
+        }
+
+        FS_INLINE static uint32_t MoveMask_m32( mask32v m )
+        {
+            return m ? 1u : 0u;
+        }
+
+        FS_INLINE static void StorePacked_u8( void* p, int32v a )
+        {
+            *reinterpret_cast<uint8_t*>(p) = static_cast<uint8_t>(std::min( std::max( static_cast<int32_t>(a), 0 ), 255 ));
+        }
+
+        FS_INLINE static void StorePacked_u16( void* p, int32v a )
+        {
+            *reinterpret_cast<uint16_t*>(p) = static_cast<uint16_t>(std::min( std::max( static_cast<int32_t>(a), 0 ), 65535 ));
+        }
+
+        FS_INLINE static void StorePacked_i16( void* p, int32v a )
+        {
+            *reinterpret_cast<int16_t*>(p) = static_cast<int16_t>(std::min( std::max( static_cast<int32_t>(a), -32768 ), 32767 ));
+        }
+
+        FS_INLINE static void StorePacked_f16( void* p, float32v a )
+        {
+            union
+            {
+                uint32_t u;
+                float    f;
+            } v, denormMagic;
+
+            v.f = a;
+            denormMagic.u = ((127 - 15) + (23 - 10) + 1) << 23;
+
+            uint32_t sign = v.u & 0x80000000u;
+            uint32_t half;
+
+            v.u ^= sign;
+
+            if( v.u >= (127 + 16) << 23 ) // Inf, NaN or out of range
+            {
+                half = v.u > 0x7F800000u ? 0x7E00u | ((v.u >> 13) & 0x3FFu) : 0x7C00u;
+            }
+            else if( v.u < 113u << 23 ) // Denormal or zero
+            {
+                v.f += denormMagic.f;
+                half = v.u - denormMagic.u;
+            }
+            else
+            {
+                uint32_t mantissaOdd = (v.u >> 13) & 1;
+                half = (v.u + ((uint32_t)(15 - 127) << 23) + 0xFFF + mantissaOdd) >> 13;
+            }
+
+            *reinterpret_cast<uint16_t*>(p) = static_cast<uint16_t>(half | (sign >> 16));
+        }
+
         // Cast
 
         FS_INLINE static float32v Casti32_f32( int32v a )
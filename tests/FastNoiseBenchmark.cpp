@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 #include <FastNoise/FastNoise.h>
 
@@ -81,6 +85,178 @@ void BenchFastNoiseGenerator3D( benchmark::State& state, size_t testSize, const
     state.SetItemsProcessed( totalData );
 }
 
+// Measures the latency of individual calls, batchSize 1 uses GenSingle3D otherwise GenSmallBatch3D
+// Each sample times kCallsPerSample back to back calls so clock reads do not dominate, the cost of an empty timed sample is measured up front
+// p50_ns/p99_ns are per call with that clock overhead subtracted, raw_p50_ns and clock_ns are reported alongside
+void BenchFastNoiseLatency3D( benchmark::State& state, int32_t batchSize, const FastNoise::Metadata* metadata, FastSIMD::eLevel level )
+{
+    constexpr int32_t kCallsPerSample = 32;
+
+    FastNoise::SmartNode<> generator = BuildGenerator( state, metadata, level );
+    if (!generator) return;
+
+    std::vector<float> xPos( batchSize ), yPos( batchSize ), zPos( batchSize ), data( batchSize );
+    std::vector<double> latencyNs;
+    int seed = 0;
+
+    for( int32_t i = 0; i < batchSize; i++ )
+    {
+        xPos[i] = i * 0.37f;
+        yPos[i] = i * -0.21f;
+        zPos[i] = i * 0.13f;
+    }
+
+    std::vector<double> clockNs( 1024 );
+
+    for( double& sample : clockNs )
+    {
+        auto start = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize( data.data() );
+        sample = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count();
+    }
+
+    std::sort( clockNs.begin(), clockNs.end() );
+    double clockOverheadNs = clockNs[clockNs.size() / 2];
+
+    for( auto _ : state )
+    {
+        (void)_;
+        auto start = std::chrono::steady_clock::now();
+
+        for( int32_t call = 0; call < kCallsPerSample; call++ )
+        {
+            if( batchSize == 1 )
+            {
+                data[0] = generator->GenSingle3D( xPos[0], yPos[0], zPos[0], seed++ );
+            }
+            else
+            {
+                generator->GenSmallBatch3D( data.data(), batchSize, xPos.data(), yPos.data(), zPos.data(), seed++ );
+            }
+
+            benchmark::DoNotOptimize( data.data() );
+        }
+
+        latencyNs.push_back( std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count() );
+    }
+
+    if( latencyNs.empty() ) return;
+
+    std::sort( latencyNs.begin(), latencyNs.end() );
+
+    auto perCall = [&]( double sampleNs )
+    {
+        return std::max( 0.0, sampleNs - clockOverheadNs ) / kCallsPerSample;
+    };
+
+    state.counters["p50_ns"] = perCall( latencyNs[latencyNs.size() / 2] );
+    state.counters["p99_ns"] = perCall( latencyNs[latencyNs.size() * 99 / 100] );
+    state.counters["raw_p50_ns"] = latencyNs[latencyNs.size() / 2] / kCallsPerSample;
+    state.counters["clock_ns"] = clockOverheadNs;
+    state.SetItemsProcessed( latencyNs.size() * kCallsPerSample * batchSize );
+}
+
+// Heightmap much larger than the last level cache, compares normal and non temporal output stores
+void BenchFastNoiseLargeOutput2D( benchmark::State& state, int32_t testSize, FastNoise::OutputStoreHint hint, FastSIMD::eLevel level )
+{
+    auto fractal = FastNoise::New<FastNoise::FractalFBm>( level );
+    fractal->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+    fractal->SetOctaveCount( 3 );
+
+    size_t dataSize = (size_t)testSize * testSize;
+
+    std::vector<float> data( dataSize );
+    size_t totalData = 0;
+    int seed = 0;
+
+    for( auto _ : state )
+    {
+        (void)_;
+        fractal->GenUniformGrid2D( data.data(), hint, 0, 0, testSize, testSize, 0.01f, seed++ );
+        totalData += dataSize;
+    }
+
+    state.SetItemsProcessed( totalData );
+    state.SetBytesProcessed( totalData * sizeof( float ) );
+}
+
+// Fractal grid near the origin through the regular API or far from it through the large world API, shows the cost of the double offset
+void BenchFastNoiseLargeWorld3D( benchmark::State& state, int32_t testSize, bool largeWorld, FastSIMD::eLevel level )
+{
+    auto fractal = FastNoise::New<FastNoise::FractalFBm>( level );
+    fractal->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+    fractal->SetOctaveCount( 5 );
+
+    size_t dataSize = (size_t)testSize * testSize * testSize;
+
+    std::vector<float> data( dataSize );
+    size_t totalData = 0;
+    int seed = 0;
+
+    for( auto _ : state )
+    {
+        (void)_;
+        if( largeWorld )
+        {
+            fractal->GenLargeWorldUniformGrid3D( data.data(), 10000000000ll, -10000000000ll, 123456789ll, testSize, testSize, testSize, 0.02f, seed++ );
+        }
+        else
+        {
+            fractal->GenUniformGrid3D( data.data(), 0, 0, 0, testSize, testSize, testSize, 0.02f, seed++ );
+        }
+        totalData += dataSize;
+    }
+
+    state.SetItemsProcessed( totalData );
+}
+
+// Three outputs derived from one fractal, generated by separate calls or one multi output call sharing the fractal
+void BenchFastNoiseMultiOutput3D( benchmark::State& state, int32_t testSize, bool multiOutput, FastSIMD::eLevel level )
+{
+    auto fractal = FastNoise::New<FastNoise::FractalFBm>( level );
+    fractal->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+    fractal->SetOctaveCount( 6 );
+
+    auto remap = FastNoise::New<FastNoise::Remap>( level );
+    remap->SetSource( fractal );
+    remap->SetRemap( -1, 1, 0, 1 );
+
+    auto multiply = FastNoise::New<FastNoise::Multiply>( level );
+    multiply->SetLHS( fractal );
+    multiply->SetRHS( 2.0f );
+
+    auto outputs = FastNoise::New<FastNoise::MultiOutput>( level );
+    outputs->SetOutputCount( 3 );
+    outputs->SetOutput( 0, fractal );
+    outputs->SetOutput( 1, remap );
+    outputs->SetOutput( 2, multiply );
+
+    size_t dataSize = (size_t)testSize * testSize * testSize;
+
+    std::vector<float> data( dataSize * 3 );
+    float* noiseOuts[3] = { data.data(), data.data() + dataSize, data.data() + dataSize * 2 };
+    size_t totalData = 0;
+    int seed = 0;
+
+    for( auto _ : state )
+    {
+        (void)_;
+        if( multiOutput )
+        {
+            outputs->GenUniformGrid3D( noiseOuts, 1, 0, 0, 0, testSize, testSize, testSize, 0.1f, seed++ );
+        }
+        else
+        {
+            fractal->GenUniformGrid3D( noiseOuts[0], 0, 0, 0, testSize, testSize, testSize, 0.1f, seed );
+            remap->GenUniformGrid3D( noiseOuts[1], 0, 0, 0, testSize, testSize, testSize, 0.1f, seed );
+            multiply->GenUniformGrid3D( noiseOuts[2], 0, 0, 0, testSize, testSize, testSize, 0.1f, seed++ );
+        }
+        totalData += dataSize * 3;
+    }
+
+    state.SetItemsProcessed( totalData );
+}
+
 int main( int argc, char** argv )
 {
     benchmark::Initialize( &argc, argv );
@@ -94,6 +270,37 @@ int main( int argc, char** argv )
             continue;
         }
 
+        // 16384^2 floats = 1GB output
+        benchName = "LargeOutput2D/Default/";
+        benchName += magic_enum::flags::enum_name( level );
+
+        benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseLargeOutput2D, 16384, FastNoise::OutputStoreHint::Default, level )->Unit( benchmark::kMillisecond );
+
+        benchName = "LargeOutput2D/NonTemporal/";
+        benchName += magic_enum::flags::enum_name( level );
+
+        benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseLargeOutput2D, 16384, FastNoise::OutputStoreHint::NonTemporal, level )->Unit( benchmark::kMillisecond );
+
+        benchName = "LargeWorld3D/Regular/";
+        benchName += magic_enum::flags::enum_name( level );
+
+        benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseLargeWorld3D, 64, false, level );
+
+        benchName = "LargeWorld3D/LargeWorld/";
+        benchName += magic_enum::flags::enum_name( level );
+
+        benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseLargeWorld3D, 64, true, level );
+
+        benchName = "MultiOutput3D/Separate/";
+        benchName += magic_enum::flags::enum_name( level );
+
+        benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseMultiOutput3D, 64, false, level );
+
+        benchName = "MultiOutput3D/Shared/";
+        benchName += magic_enum::flags::enum_name( level );
+
+        benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseMultiOutput3D, 64, true, level );
+
         for( const FastNoise::Metadata* metadata : FastNoise::Metadata::GetMetadataClasses() )
         {
             benchName = "2D/";
@@ -106,6 +313,10 @@ int main( int argc, char** argv )
             benchName[0] = '3';
 
             benchmark::RegisterBenchmark( benchName.c_str(), BenchFastNoiseGenerator3D, 64, metadata, level );
+
+            benchmark::RegisterBenchmark( ( "Single3D" + benchName.substr( 2 ) ).c_str(), BenchFastNoiseLatency3D, 1, metadata, level );
+
+            benchmark::RegisterBenchmark( ( "Batch16_3D" + benchName.substr( 2 ) ).c_str(), BenchFastNoiseLatency3D, 16, metadata, level );
         
         }
     }
@@ -0,0 +1,1715 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FastNoise/FastNoise.h"
+
+// Generator level tests, run at every SIMD level the CPU supports
+
+class FastNoiseUnitTest
+{
+public:
+    static int RunAll();
+
+    FastNoiseUnitTest( const char* name, std::function<void( FastSIMD::eLevel )> func )
+    {
+        tests.emplace_back( name, func );
+    }
+
+    static void Fail( const char* condition, int line )
+    {
+        printf( "  %s level %d, line %d: %s\n", currentTest, (int)currentLevel, line, condition );
+        failCount++;
+    }
+
+private:
+    inline static std::vector<std::pair<const char*, std::function<void( FastSIMD::eLevel )>>> tests;
+    inline static const char* currentTest;
+    inline static FastSIMD::eLevel currentLevel;
+    inline static int failCount = 0;
+};
+
+int FastNoiseUnitTest::RunAll()
+{
+    const FastSIMD::eLevel levels[] = { FastSIMD::Level_Scalar, FastSIMD::Level_SSE2, FastSIMD::Level_SSE41, FastSIMD::Level_AVX2, FastSIMD::Level_AVX512 };
+
+    for( const auto& test : tests )
+    {
+        printf( "%s\n", test.first );
+        currentTest = test.first;
+
+        for( FastSIMD::eLevel level : levels )
+        {
+            if( ( level & FastSIMD::COMPILED_SIMD_LEVELS ) && level <= FastSIMD::CPUMaxSIMDLevel() )
+            {
+                currentLevel = level;
+                test.second( level );
+            }
+        }
+    }
+
+    printf( "%d failures\n", failCount );
+    return failCount;
+}
+
+#define FASTNOISE_TEST( NAME )                                                              \
+static void Test_##NAME( FastSIMD::eLevel level );                                          \
+static FastNoiseUnitTest TestRegister_##NAME( #NAME, Test_##NAME );                         \
+static void Test_##NAME( FastSIMD::eLevel level )
+
+#define TEST_CHECK( CONDITION ) if( !( CONDITION ) ) FastNoiseUnitTest::Fail( #CONDITION, __LINE__ )
+
+static bool NearlyEqual( float a, float b, float tolerance = 1e-5f )
+{
+    return std::fabs( a - b ) <= tolerance * std::fmax( 1.0f, std::fabs( b ) );
+}
+
+FASTNOISE_TEST( ExpressionParser )
+{
+    auto expression = FastNoise::New<FastNoise::Expression>( level );
+    expression->SetSource( 0, 3.0f );
+    expression->SetSource( 1, 5.0f );
+
+    struct Case
+    {
+        const char* expression;
+        float expected;
+    };
+
+    const float x = 0.75f, y = -2.5f;
+
+    const Case cases[] =
+    {
+        { "1 + 2 * 3", 7.0f },
+        { "(1 + 2) * 3", 9.0f },
+        { "8 - 2 - 1", 5.0f },
+        { "16 / 4 / 2", 2.0f },
+        { "a + b * x", 3.0f + 5.0f * x },
+        { "(a + b) * x", ( 3.0f + 5.0f ) * x },
+        { "-x", -x },
+        { "--x", x },
+        { "-2 * -y", 2.0f * y },
+        { "a - -b", 8.0f },
+        { "+x - +y", x - y },
+        { "x * -(y - 1)", x * -( y - 1 ) },
+        { "min(x, y) + max(x, y)", x + y },
+        { "clamp(y, -1, 1) + clamp(x * 4, 0, 1)", -1.0f + 1.0f },
+        { "lerp(a, b, x)", 3.0f + 2.0f * x },
+        { "abs(y) + sqrt(a * 3) + floor(y) + ceil(x) + round(2.5)", 2.5f + 3.0f - 3.0f + 1.0f + 2.0f },
+        { "sin(pi / 2) * cos(0) + sin(x) * 0", 1.0f },
+        { "2 * 3 + 4 * (5 - 1) + x * 0", 22.0f },
+        { "min(2, 3) * max(-1, -4) + clamp(7, 0, 5) + x", -2.0f + 5.0f + x },
+        { "x * x + x * x", 2.0f * x * x },
+        { "c + z", 0.0f },
+    };
+
+    for( const Case& test : cases )
+    {
+        bool compiled = expression->SetExpression( test.expression );
+        TEST_CHECK( compiled );
+
+        if( compiled )
+        {
+            float result = expression->GenSingle2D( x, y, 0 );
+
+            if( !NearlyEqual( result, test.expected ) )
+            {
+                printf( "    \"%s\" = %f, expected %f\n", test.expression, result, test.expected );
+                TEST_CHECK( NearlyEqual( result, test.expected ) );
+            }
+        }
+    }
+
+    for( const char* invalid : { "", "a +", "(a", "a)", "foo(a)", "min(a)", "clamp(a, 1)", "q", "a b", "1 +* 2" } )
+    {
+        TEST_CHECK( !expression->SetExpression( invalid ) );
+    }
+
+    // Failed compiles keep the previous expression
+    TEST_CHECK( expression->GetExpression() == "c + z" );
+}
+
+FASTNOISE_TEST( ExpressionGrid )
+{
+    auto sourceA = FastNoise::New<FastNoise::Simplex>( level );
+    auto sourceB = FastNoise::New<FastNoise::Perlin>( level );
+    auto expression = FastNoise::New<FastNoise::Expression>( level );
+    expression->SetSource( 0, sourceA );
+    expression->SetSource( 1, sourceB );
+    TEST_CHECK( expression->SetExpression( "clamp(a * 0.7 + b * b - 0.2, 0, 1) + lerp(a, b, 0.25) - min(a, b) * (2 * 3 - 5)" ) );
+
+    const int32_t size = 37;
+    std::vector<float> result( size * size ), a( size * size ), b( size * size );
+
+    expression->GenUniformGrid2D( result.data(), 0, 0, size, size, 0.02f, 1337 );
+    sourceA->GenUniformGrid2D( a.data(), 0, 0, size, size, 0.02f, 1337 );
+    sourceB->GenUniformGrid2D( b.data(), 0, 0, size, size, 0.02f, 1337 );
+
+    for( size_t i = 0; i < result.size(); i++ )
+    {
+        float expected = std::fmin( std::fmax( a[i] * 0.7f + b[i] * b[i] - 0.2f, 0.0f ), 1.0f ) + ( a[i] + ( b[i] - a[i] ) * 0.25f ) - std::fmin( a[i], b[i] );
+
+        if( !NearlyEqual( result[i], expected, 1e-4f ) )
+        {
+            TEST_CHECK( NearlyEqual( result[i], expected, 1e-4f ) );
+            break;
+        }
+    }
+}
+
+FASTNOISE_TEST( ExpressionRegisters )
+{
+    auto expression = FastNoise::New<FastNoise::Expression>( level );
+
+    // Many more distinct constants than registers, but only a couple are live at once
+    std::string longSum = "x * 1";
+    float expected = 0.5f;
+
+    for( int i = 2; i <= 100; i++ )
+    {
+        longSum += " + x * " + std::to_string( i ) + " + " + std::to_string( i ) + " * 2";
+        expected += 0.5f * i + i * 2.0f;
+    }
+
+    TEST_CHECK( expression->SetExpression( longSum.c_str() ) );
+    TEST_CHECK( NearlyEqual( expression->GenSingle2D( 0.5f, 0.0f, 0 ), expected ) );
+
+    // Nesting keeps every partial sum live until the innermost term, more than the register file holds
+    std::string deepNesting;
+    for( int i = 0; i < FastNoise::Expression::kMaxRegisters + 8; i++ )
+    {
+        deepNesting += "x * " + std::to_string( i + 1 ) + " + (";
+    }
+    deepNesting += "y" + std::string( FastNoise::Expression::kMaxRegisters + 8, ')' );
+
+    TEST_CHECK( !expression->SetExpression( deepNesting.c_str() ) );
+
+    // Nested just within the limit still compiles
+    std::string shallowNesting;
+    for( int i = 0; i < FastNoise::Expression::kMaxRegisters - 4; i++ )
+    {
+        shallowNesting += "x * " + std::to_string( i + 1 ) + " + (";
+    }
+    shallowNesting += "y" + std::string( FastNoise::Expression::kMaxRegisters - 4, ')' );
+
+    TEST_CHECK( expression->SetExpression( shallowNesting.c_str() ) );
+}
+
+FASTNOISE_TEST( LargeWorldShiftedOrigin )
+{
+    auto fractal = FastNoise::New<FastNoise::FractalFBm>( level );
+    fractal->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+    fractal->SetOctaveCount( 4 );
+
+    const FastNoise::SmartNode<> generators[] =
+    {
+        FastNoise::New<FastNoise::Perlin>( level ),
+        FastNoise::New<FastNoise::Simplex>( level ),
+        FastNoise::New<FastNoise::OpenSimplex2>( level ),
+        FastNoise::New<FastNoise::Value>( level ),
+        FastNoise::New<FastNoise::CellularDistance>( level ),
+        fractal,
+    };
+
+    const int32_t count = 53;
+    const float shift = 16.0f;
+    std::vector<float> x( count ), y( count ), z( count ), xShifted( count ), yShifted( count ), zShifted( count );
+
+    for( int32_t i = 0; i < count; i++ )
+    {
+        x[i] = i * 0.37f;
+        y[i] = i * -0.21f;
+        z[i] = i * 0.13f;
+        xShifted[i] = x[i] + shift;
+        yShifted[i] = y[i] + shift;
+        zShifted[i] = z[i] + shift;
+    }
+
+    std::vector<float> result( count ), shifted( count );
+
+    // The same world positions reached from origins one shift apart must match
+    // Tolerance covers rounding of the shifted positions and the small seams OpenSimplex2 3D has at any origin, a wrong lattice split is off by far more
+    for( double origin : { 1e7 + 0.3, -1e7 - 0.7 } )
+    {
+        for( const auto& generator : generators )
+        {
+            generator->GenLargeWorldPositionArray2D( result.data(), count, x.data(), y.data(), origin, -origin, 1337 );
+            generator->GenLargeWorldPositionArray2D( shifted.data(), count, xShifted.data(), yShifted.data(), origin - shift, -origin - shift, 1337 );
+
+            for( int32_t i = 0; i < count; i++ )
+            {
+                if( !NearlyEqual( result[i], shifted[i], 5e-3f ) )
+                {
+                    TEST_CHECK( NearlyEqual( result[i], shifted[i], 5e-3f ) );
+                    break;
+                }
+            }
+
+            generator->GenLargeWorldPositionArray3D( result.data(), count, x.data(), y.data(), z.data(), origin, -origin, origin, 1337 );
+            generator->GenLargeWorldPositionArray3D( shifted.data(), count, xShifted.data(), yShifted.data(), zShifted.data(), origin - shift, -origin - shift, origin - shift, 1337 );
+
+            for( int32_t i = 0; i < count; i++ )
+            {
+                if( !NearlyEqual( result[i], shifted[i], 5e-3f ) )
+                {
+                    TEST_CHECK( NearlyEqual( result[i], shifted[i], 5e-3f ) );
+                    break;
+                }
+            }
+        }
+
+        // World position outputs round once, floats are 1 apart at 1e7
+        auto position = FastNoise::New<FastNoise::PositionOutput>( level );
+        position->Set<FastNoise::Dim::X>( 1.0f );
+
+        auto expression = FastNoise::New<FastNoise::Expression>( level );
+        TEST_CHECK( expression->SetExpression( "x" ) );
+
+        for( const FastNoise::SmartNode<> generator : { FastNoise::SmartNode<>( position ), FastNoise::SmartNode<>( expression ) } )
+        {
+            generator->GenLargeWorldPositionArray2D( result.data(), count, x.data(), y.data(), origin, 0, 0 );
+
+            for( int32_t i = 0; i < count; i++ )
+            {
+                if( std::fabs( result[i] - ( origin + x[i] ) ) > 0.5 )
+                {
+                    TEST_CHECK( std::fabs( result[i] - ( origin + x[i] ) ) <= 0.5 );
+                    break;
+                }
+            }
+        }
+    }
+}
+
+FASTNOISE_TEST( NarrowGrids )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+    const float frequency = 0.37f;
+
+    // Rows and slices shorter than a vector make one vector span several of them
+    for( int32_t xSize : { 1, 2, 3, 5, 7, 13 } )
+    {
+        for( int32_t ySize : { 1, 3, 4 } )
+        {
+            const int32_t zSize = 3;
+            const int32_t xStart = -2, yStart = 5, zStart = 1;
+            size_t count = (size_t)xSize * ySize * zSize;
+
+            std::vector<float> xPos( count ), yPos( count ), zPos( count );
+            std::vector<float> expected2D( count ), expected3D( count ), expectedZYX( count ), result( count );
+
+            for( size_t i = 0; i < count; i++ )
+            {
+                xPos[i] = (float)( xStart + (int32_t)( i % xSize ) ) * frequency;
+                yPos[i] = (float)( yStart + (int32_t)( i / xSize % ySize ) ) * frequency;
+                zPos[i] = (float)( zStart + (int32_t)( i / xSize / ySize ) ) * frequency;
+            }
+
+            generator->GenPositionArray3D( expected3D.data(), (int32_t)count, xPos.data(), yPos.data(), zPos.data(), 0, 0, 0, 1337 );
+
+            for( size_t i = 0; i < count; i++ )
+            {
+                // LinearZYX has z fastest, element ( x, y, z ) lands at ( x * ySize + y ) * zSize + z
+                size_t x = i % xSize, y = i / xSize % ySize, z = i / xSize / ySize;
+                expectedZYX[( x * ySize + y ) * zSize + z] = expected3D[i];
+            }
+
+            generator->GenUniformGrid3D( result.data(), xStart, yStart, zStart, xSize, ySize, zSize, frequency, 1337 );
+            TEST_CHECK( result == expected3D );
+
+            generator->GenUniformGrid3D( result.data(), FastNoise::GridLayout3D::LinearXYZ, xStart, yStart, zStart, xSize, ySize, zSize, frequency, 1337 );
+            TEST_CHECK( result == expected3D );
+
+            generator->GenUniformGrid3D( result.data(), FastNoise::GridLayout3D::LinearZYX, xStart, yStart, zStart, xSize, ySize, zSize, frequency, 1337 );
+            TEST_CHECK( result == expectedZYX );
+
+            size_t count2D = (size_t)xSize * ySize;
+            generator->GenPositionArray2D( expected2D.data(), (int32_t)count2D, xPos.data(), yPos.data(), 0, 0, 1337 );
+            expected2D.resize( count2D );
+            result.resize( count2D );
+
+            generator->GenUniformGrid2D( result.data(), xStart, yStart, xSize, ySize, frequency, 1337 );
+            TEST_CHECK( result == expected2D );
+
+            const float origin[2] = { xStart * frequency, yStart * frequency };
+            const float xStep[2] = { frequency, 0 };
+            const float yStep[2] = { 0, frequency };
+
+            generator->GenAffineGrid2D( result.data(), origin, xStep, yStep, xSize, ySize, 1337 );
+
+            for( size_t i = 0; i < count2D; i++ )
+            {
+                if( !NearlyEqual( result[i], expected2D[i], 1e-4f ) )
+                {
+                    TEST_CHECK( NearlyEqual( result[i], expected2D[i], 1e-4f ) );
+                    break;
+                }
+            }
+        }
+    }
+}
+
+FASTNOISE_TEST( PitchedGrids )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+
+    // Narrow rows make a vector straddle several rows of the pitched output
+    for( int32_t xSize : { 1, 3, 5, 17 } )
+    {
+        const int32_t ySize = 4, zSize = 3;
+        const size_t rowPitch = xSize + 2, slicePitch = rowPitch * ( ySize + 1 );
+
+        std::vector<float> expected( (size_t)xSize * ySize * zSize );
+        std::vector<float> result( slicePitch * zSize, -99.0f );
+
+        generator->GenUniformGrid3D( expected.data(), 4, -2, 9, xSize, ySize, zSize, 0.05f, 1337 );
+        generator->GenUniformGrid3DPitched( result.data(), rowPitch, slicePitch, 4, -2, 9, xSize, ySize, zSize, 0.05f, 1337 );
+
+        for( size_t i = 0; i < result.size(); i++ )
+        {
+            size_t z = i / slicePitch, y = i % slicePitch / rowPitch, x = i % slicePitch % rowPitch;
+            bool inside = y < (size_t)ySize && x < (size_t)xSize;
+
+            TEST_CHECK( result[i] == ( inside ? expected[( z * ySize + y ) * xSize + x] : -99.0f ) );
+        }
+    }
+}
+
+FASTNOISE_TEST( StatsHistogramRange )
+{
+    // Values far outside the histogram range, beyond what an int32 bin index can hold
+    auto position = FastNoise::New<FastNoise::PositionOutput>( level );
+    position->Set<FastNoise::Dim::X>( 1e30f );
+
+    const int32_t xSize = 21;
+    FastNoise::OutputStats stats;
+    stats.flags = FastNoise::OutputStats::Histogram;
+
+    position->GenUniformGrid2D( nullptr, stats, -10, 0, xSize, 1, 1.0f, 1337 );
+
+    // x == 0 lands in the middle bin
+    TEST_CHECK( stats.histogram[0] == 10 );
+    TEST_CHECK( stats.histogram[FastNoise::OutputStats::kHistogramBins / 2] == 1 );
+    TEST_CHECK( stats.histogram[FastNoise::OutputStats::kHistogramBins - 1] == 10 );
+}
+
+FASTNOISE_TEST( FormatEmptyRange )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+
+    FastNoise::OutputFormat format;
+    format.type = FastNoise::OutputFormat::UInt16;
+    format.rangeMin = 0.25f;
+    format.rangeMax = 0.25f;
+
+    std::vector<uint16_t> result( 37, 1 );
+    generator->GenUniformGrid2D( result.data(), format, 0, 0, 37, 1, 0.1f, 1337 );
+
+    for( uint16_t value : result )
+    {
+        TEST_CHECK( value == 0 );
+    }
+}
+
+FASTNOISE_TEST( QuantiseToFormat )
+{
+    auto generator = FastNoise::New<FastNoise::Simplex>( level );
+
+    FastNoise::OutputFormat format;
+    format.type = FastNoise::OutputFormat::Int16;
+    format.rangeMin = -0.8f;
+    format.rangeMax = 0.6f;
+
+    const int32_t size = 37;
+    std::vector<float> values( size * size );
+    std::vector<int16_t> expected( size * size ), result( size * size );
+
+    generator->GenUniformGrid2D( values.data(), 0, 0, size, size, 0.05f, 1337 );
+    generator->GenUniformGrid2D( expected.data(), format, 0, 0, size, size, 0.05f, 1337 );
+    generator->QuantiseToFormat( result.data(), format, values.data(), values.size() );
+
+    TEST_CHECK( result == expected );
+}
+
+FASTNOISE_TEST( GridTails )
+{
+    // Tileable grids sample a torus, z is sin( 2pi * x / xSize ) * frequency * xSize / 2pi
+    auto position = FastNoise::New<FastNoise::PositionOutput>( level );
+    position->Set<FastNoise::Dim::Z>( 1.0f );
+
+    const int32_t ySize = 5;
+    std::vector<float> wide( 16 * ySize ), narrow( 13 * ySize );
+
+    position->GenTileable2D( narrow.data(), 13, ySize, 0.2f, 1337 );
+
+    for( int32_t i = 0; i < 13 * ySize; i++ )
+    {
+        float expected = std::sin( 6.2831853f * ( i % 13 ) / 13 ) * 0.2f * 13 / 6.2831853f;
+        TEST_CHECK( NearlyEqual( narrow[i], expected, 1e-2f ) );
+    }
+
+    // A narrower grid is the leading columns of a wider one, which has no partial vector
+    auto generator = FastNoise::New<FastNoise::Simplex>( level );
+
+    generator->GenCubeSphereGrid( wide.data(), 2, 0, 0, 16, ySize, 16, 100.0f, 0.05f, 1337 );
+    generator->GenCubeSphereGrid( narrow.data(), 2, 0, 0, 13, ySize, 16, 100.0f, 0.05f, 1337 );
+
+    for( int32_t y = 0; y < ySize; y++ )
+    {
+        for( int32_t x = 0; x < 13; x++ )
+        {
+            TEST_CHECK( narrow[y * 13 + x] == wide[y * 16 + x] );
+        }
+    }
+}
+
+FASTNOISE_TEST( ChunkCache )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+    const int32_t chunkSize = 32;
+    const size_t chunkBytes = chunkSize * chunkSize * sizeof( float );
+
+    auto getChunk = [&]( FastNoise::ChunkCache& cache, int32_t chunk )
+    {
+        return cache.GetUniformGrid2D( *generator, 1, chunk * chunkSize, 0, chunkSize, chunkSize, 0.02f, 1337 );
+    };
+
+    // Least recently used order, room for 2 chunks
+    {
+        FastNoise::ChunkCache cache( chunkBytes * 2 );
+
+        getChunk( cache, 0 );
+        getChunk( cache, 1 );
+        getChunk( cache, 0 );
+        getChunk( cache, 2 ); // Evicts 1
+
+        FastNoise::ChunkCache::Counters counters = cache.GetCounters();
+        TEST_CHECK( counters.hits == 1 && counters.misses == 3 && counters.evictions == 1 );
+        TEST_CHECK( counters.chunkCount == 2 && counters.bytes == chunkBytes * 2 );
+
+        getChunk( cache, 0 );
+        TEST_CHECK( cache.GetCounters().hits == 2 );
+        getChunk( cache, 1 );
+        TEST_CHECK( cache.GetCounters().misses == 4 );
+    }
+
+    // Concurrent requests for one chunk generate it once and share the result
+    {
+        FastNoise::ChunkCache cache( chunkBytes * 4 );
+        const int threadCount = 8;
+
+        std::vector<FastNoise::ChunkCache::ChunkPtr> results( threadCount );
+        std::atomic<int> ready( 0 );
+        std::vector<std::thread> threads;
+
+        for( int i = 0; i < threadCount; i++ )
+        {
+            threads.emplace_back( [&, i]
+            {
+                for( ready++; ready < threadCount; )
+                {
+                    std::this_thread::yield();
+                }
+                results[i] = getChunk( cache, 7 );
+            } );
+        }
+
+        for( std::thread& thread : threads )
+        {
+            thread.join();
+        }
+
+        FastNoise::ChunkCache::Counters counters = cache.GetCounters();
+        TEST_CHECK( counters.misses == 1 && counters.hits == threadCount - 1 && counters.inFlightHits <= counters.hits );
+
+        for( const auto& result : results )
+        {
+            TEST_CHECK( result == results[0] );
+        }
+    }
+
+    // Threads walking overlapping chunk ranges, the cache stays within its byte bound and every chunk matches direct generation
+    {
+        FastNoise::ChunkCache cache( chunkBytes * 3 );
+        const int threadCount = 4, requestsPerThread = 200;
+
+        std::vector<float> expected( chunkSize * chunkSize );
+        std::atomic<int> mismatches( 0 );
+        std::atomic<size_t> maxBytes( 0 );
+        std::vector<std::thread> threads;
+
+        for( int t = 0; t < threadCount; t++ )
+        {
+            threads.emplace_back( [&, t]
+            {
+                for( int i = 0; i < requestsPerThread; i++ )
+                {
+                    int32_t chunk = ( i * 7 + t * 3 ) % 6;
+                    FastNoise::ChunkCache::ChunkPtr result = getChunk( cache, chunk );
+
+                    std::vector<float> values( chunkSize * chunkSize );
+                    generator->GenUniformGrid2D( values.data(), chunk * chunkSize, 0, chunkSize, chunkSize, 0.02f, 1337 );
+                    mismatches += result->values != values;
+
+                    size_t bytes = cache.GetCounters().bytes;
+                    for( size_t seen = maxBytes; bytes > seen && !maxBytes.compare_exchange_weak( seen, bytes ); ) {}
+                }
+            } );
+        }
+
+        for( std::thread& thread : threads )
+        {
+            thread.join();
+        }
+
+        FastNoise::ChunkCache::Counters counters = cache.GetCounters();
+        TEST_CHECK( mismatches == 0 );
+        TEST_CHECK( maxBytes <= chunkBytes * 3 && counters.chunkCount <= 3 );
+        TEST_CHECK( counters.hits + counters.misses == (uint64_t)threadCount * requestsPerThread );
+        TEST_CHECK( counters.misses >= 6 && counters.evictions == counters.misses - counters.chunkCount );
+    }
+
+    // A failed generation is not cached and does not leave later requests waiting
+    {
+        FastNoise::ChunkCache cache( chunkBytes * 2 );
+        const int32_t hugeSize = 1 << 30;
+
+        for( int attempt = 0; attempt < 2; attempt++ )
+        {
+            bool threw = false;
+            try
+            {
+                cache.GetUniformGrid2D( *generator, 1, 0, 0, hugeSize, hugeSize, 0.02f, 1337 );
+            }
+            catch( const std::exception& )
+            {
+                threw = true;
+            }
+            TEST_CHECK( threw );
+        }
+
+        FastNoise::ChunkCache::Counters counters = cache.GetCounters();
+        TEST_CHECK( counters.misses == 2 && counters.chunkCount == 0 && counters.bytes == 0 );
+    }
+}
+
+FASTNOISE_TEST( MultiOutputShared )
+{
+    // One fractal feeds both outputs, loaded from an encoded tree where it is encoded once per reference
+    FastNoise::NodeData simplex( FastNoise::New<FastNoise::Simplex>( level )->GetMetadata() );
+    FastNoise::NodeData fbm( FastNoise::New<FastNoise::FractalFBm>( level )->GetMetadata() );
+    FastNoise::NodeData remap( FastNoise::New<FastNoise::Remap>( level )->GetMetadata() );
+    FastNoise::NodeData multi( FastNoise::New<FastNoise::MultiOutput>( level )->GetMetadata() );
+
+    fbm.nodes[0] = &simplex;
+    remap.nodes[0] = &fbm;
+    multi.hybridLists[0] = { { &fbm, 0.0f }, { &remap, 0.0f } };
+
+    auto decoded = FastNoise::NewFromEncodedNodeTree( FastNoise::Metadata::SerialiseNodeData( &multi ).c_str(), level );
+    auto* multiOutput = dynamic_cast<FastNoise::MultiOutput*>( decoded.get() );
+
+    FastNoise::SmartNode<> outputs[2] = {
+        FastNoise::NewFromEncodedNodeTree( FastNoise::Metadata::SerialiseNodeData( &fbm ).c_str(), level ),
+        FastNoise::NewFromEncodedNodeTree( FastNoise::Metadata::SerialiseNodeData( &remap ).c_str(), level )
+    };
+
+    if( !multiOutput || !outputs[0] || !outputs[1] )
+    {
+        TEST_CHECK( multiOutput && outputs[0] && outputs[1] );
+        return;
+    }
+
+    const int32_t xSize = 13, ySize = 7, zSize = 5;
+    const int32_t count = xSize * ySize * zSize;
+
+    std::vector<float> xPos( count ), yPos( count ), zPos( count );
+    std::vector<float> expected( count ), planar[2], interleaved( count * 2 );
+
+    for( int32_t i = 0; i < count; i++ )
+    {
+        xPos[i] = i * 0.37f - 4.0f;
+        yPos[i] = i * -0.11f;
+        zPos[i] = i * 0.05f + 9.0f;
+    }
+
+    planar[0].resize( count );
+    planar[1].resize( count );
+
+    float* planarOuts[2] = { planar[0].data(), planar[1].data() };
+    float* interleavedOuts[2] = { interleaved.data(), interleaved.data() + 1 };
+
+    // Generates planar and interleaved outputs and compares each against a separate call of that output alone
+    auto check = [&]( int32_t checkCount, auto&& multiGen, auto&& single )
+    {
+        multiGen( planarOuts, 1 );
+        multiGen( interleavedOuts, 2 );
+
+        for( int32_t o = 0; o < 2; o++ )
+        {
+            single( *outputs[o], expected.data() );
+
+            bool match = true;
+            for( int32_t i = 0; i < checkCount; i++ )
+            {
+                match &= planar[o][i] == expected[i] && interleaved[i * 2 + o] == expected[i];
+            }
+            TEST_CHECK( match );
+        }
+    };
+
+    check( xSize * ySize,
+        [&]( float* const* outs, size_t stride ) { multiOutput->GenUniformGrid2D( outs, stride, -3, 8, xSize, ySize, 0.07f, 1337 ); },
+        [&]( const FastNoise::Generator& gen, float* out ) { gen.GenUniformGrid2D( out, -3, 8, xSize, ySize, 0.07f, 1337 ); } );
+
+    check( count,
+        [&]( float* const* outs, size_t stride ) { multiOutput->GenUniformGrid3D( outs, stride, -3, 8, 2, xSize, ySize, zSize, 0.07f, 1337 ); },
+        [&]( const FastNoise::Generator& gen, float* out ) { gen.GenUniformGrid3D( out, -3, 8, 2, xSize, ySize, zSize, 0.07f, 1337 ); } );
+
+    check( count,
+        [&]( float* const* outs, size_t stride ) { multiOutput->GenPositionArray2D( outs, stride, count, xPos.data(), yPos.data(), 0.5f, 0, 1337 ); },
+        [&]( const FastNoise::Generator& gen, float* out ) { gen.GenPositionArray2D( out, count, xPos.data(), yPos.data(), 0.5f, 0, 1337 ); } );
+
+    check( count,
+        [&]( float* const* outs, size_t stride ) { multiOutput->GenPositionArray3D( outs, stride, count, xPos.data(), yPos.data(), zPos.data(), 0.5f, 0, -1.0f, 1337 ); },
+        [&]( const FastNoise::Generator& gen, float* out ) { gen.GenPositionArray3D( out, count, xPos.data(), yPos.data(), zPos.data(), 0.5f, 0, -1.0f, 1337 ); } );
+}
+
+FASTNOISE_TEST( MultiSeed )
+{
+    auto generator = FastNoise::New<FastNoise::FractalFBm>( level );
+    generator->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+
+    const int32_t seeds[3] = { 1337, -5, 90210 };
+    const int32_t xSize = 13, ySize = 7, zSize = 5;
+    const size_t count = (size_t)xSize * ySize * zSize;
+
+    std::vector<float> xPos( count ), yPos( count ), zPos( count );
+    std::vector<float> results[3], expected( count );
+    float* outs[3];
+    FastNoise::OutputMinMax minMax[3];
+
+    for( size_t i = 0; i < count; i++ )
+    {
+        xPos[i] = i * 0.37f - 4.0f;
+        yPos[i] = i * -0.11f;
+        zPos[i] = i * 0.05f + 9.0f;
+    }
+
+    for( int32_t i = 0; i < 3; i++ )
+    {
+        results[i].resize( count );
+        outs[i] = results[i].data();
+    }
+
+    // Each seed must match a separate single seed call, including the partial final vector
+    auto check = [&]( size_t checkCount, auto&& single )
+    {
+        for( int32_t i = 0; i < 3; i++ )
+        {
+            FastNoise::OutputMinMax expectedMinMax;
+            single( expected.data(), seeds[i] );
+
+            for( size_t j = 0; j < checkCount; j++ )
+            {
+                expectedMinMax << expected[j];
+            }
+
+            TEST_CHECK( std::equal( expected.begin(), expected.begin() + checkCount, results[i].begin() ) );
+            TEST_CHECK( minMax[i].min == expectedMinMax.min && minMax[i].max == expectedMinMax.max );
+        }
+    };
+
+    generator->GenUniformGrid2D( outs, -3, 8, xSize, ySize, 0.07f, seeds, 3, minMax );
+    check( (size_t)xSize * ySize, [&]( float* out, int32_t seed ) { generator->GenUniformGrid2D( out, -3, 8, xSize, ySize, 0.07f, seed ); } );
+
+    generator->GenUniformGrid3D( outs, -3, 8, 2, xSize, ySize, zSize, 0.07f, seeds, 3, minMax );
+    check( count, [&]( float* out, int32_t seed ) { generator->GenUniformGrid3D( out, -3, 8, 2, xSize, ySize, zSize, 0.07f, seed ); } );
+
+    generator->GenPositionArray2D( outs, (int32_t)count, xPos.data(), yPos.data(), 0.5f, 0, seeds, 3, minMax );
+    check( count, [&]( float* out, int32_t seed ) { generator->GenPositionArray2D( out, (int32_t)count, xPos.data(), yPos.data(), 0.5f, 0, seed ); } );
+
+    generator->GenPositionArray3D( outs, (int32_t)count, xPos.data(), yPos.data(), zPos.data(), 0.5f, 0, -1.0f, seeds, 3, minMax );
+    check( count, [&]( float* out, int32_t seed ) { generator->GenPositionArray3D( out, (int32_t)count, xPos.data(), yPos.data(), zPos.data(), 0.5f, 0, -1.0f, seed ); } );
+}
+
+FASTNOISE_TEST( TiledGrids )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+    const int32_t xSize = 70, ySize = 45, zSize = 19, tileSize = 16;
+
+    std::vector<float> expected( (size_t)xSize * ySize * zSize );
+    std::vector<float> result( expected.size(), -99.0f );
+    std::atomic<int32_t> tileCount( 0 );
+    int32_t gridZSize = zSize;
+
+    // Tiles never overlap so concurrent visitors write disjoint parts of result
+    auto copyTile = [&]( const FastNoise::GridTile& tile )
+    {
+        TEST_CHECK( tile.xSize == std::min( tileSize, xSize - tile.x ) );
+        TEST_CHECK( tile.ySize == std::min( tileSize, ySize - tile.y ) );
+        TEST_CHECK( tile.zSize == std::min( tileSize, gridZSize - tile.z ) );
+
+        for( int32_t z = 0; z < tile.zSize; z++ )
+        {
+            for( int32_t y = 0; y < tile.ySize; y++ )
+            {
+                for( int32_t x = 0; x < tile.xSize; x++ )
+                {
+                    size_t tileIndex = ( (size_t)z * tile.ySize + y ) * tile.xSize + x;
+                    result[( (size_t)( tile.z + z ) * ySize + tile.y + y ) * xSize + tile.x + x] = tile.values[tileIndex];
+                }
+            }
+        }
+
+        tileCount++;
+    };
+
+    for( int32_t threadCount : { 1, 3 } )
+    {
+        gridZSize = zSize;
+        FastNoise::OutputMinMax expectedMinMax = generator->GenUniformGrid3D( expected.data(), -7, 3, 11, xSize, ySize, zSize, 0.04f, 1337 );
+        FastNoise::OutputMinMax minMax = FastNoise::GenUniformGrid3DTiled( *generator, copyTile, -7, 3, 11, xSize, ySize, zSize, 0.04f, 1337, tileSize, threadCount );
+
+        TEST_CHECK( tileCount.exchange( 0 ) == 5 * 3 * 2 );
+        TEST_CHECK( result == expected );
+#if FASTNOISE_CALC_MIN_MAX
+        TEST_CHECK( minMax.min == expectedMinMax.min && minMax.max == expectedMinMax.max );
+#endif
+
+        gridZSize = 1;
+        expected.resize( (size_t)xSize * ySize );
+        result.assign( expected.size(), -99.0f );
+
+        expectedMinMax = generator->GenUniformGrid2D( expected.data(), -7, 3, xSize, ySize, 0.04f, 1337 );
+        minMax = FastNoise::GenUniformGrid2DTiled( *generator, copyTile, -7, 3, xSize, ySize, 0.04f, 1337, tileSize, threadCount );
+
+        TEST_CHECK( tileCount.exchange( 0 ) == 5 * 3 );
+        TEST_CHECK( result == expected );
+#if FASTNOISE_CALC_MIN_MAX
+        TEST_CHECK( minMax.min == expectedMinMax.min && minMax.max == expectedMinMax.max );
+#endif
+
+        expected.resize( (size_t)xSize * ySize * zSize );
+        result.assign( expected.size(), -99.0f );
+    }
+
+    // A throwing visitor stops handing out tiles and the exception reaches the caller after every thread is joined
+    for( int32_t threadCount : { 1, 3 } )
+    {
+        bool caught = false;
+
+        try
+        {
+            FastNoise::GenUniformGrid2DTiled( *generator, [&]( const FastNoise::GridTile& tile )
+            {
+                if( tileCount++ == 2 )
+                {
+                    throw std::runtime_error( "tile" );
+                }
+            }, 0, 0, 256, 256, 0.04f, 1337, tileSize, threadCount );
+        }
+        catch( const std::runtime_error& )
+        {
+            caught = true;
+        }
+
+        TEST_CHECK( caught );
+        TEST_CHECK( tileCount.exchange( 0 ) < 16 * 16 );
+    }
+}
+
+static std::vector<uint8_t> ReadFile( const char* path )
+{
+    std::vector<uint8_t> data;
+    FILE* file = fopen( path, "rb" );
+
+    if( file )
+    {
+        fseek( file, 0, SEEK_END );
+        data.resize( (size_t)ftell( file ) );
+        fseek( file, 0, SEEK_SET );
+        data.resize( fread( data.data(), 1, data.size(), file ) );
+        fclose( file );
+    }
+    return data;
+}
+
+static void WriteFile( const char* path, const std::vector<uint8_t>& data )
+{
+    FILE* file = fopen( path, "wb" );
+    fwrite( data.data(), 1, data.size(), file );
+    fclose( file );
+}
+
+FASTNOISE_TEST( ExportGrid )
+{
+    const char* path = "FastNoiseUnitTest_ExportGrid.bin";
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+
+    for( int32_t dimensions : { 2, 3 } )
+    {
+        for( FastNoise::OutputFormat::Type type : { FastNoise::OutputFormat::Float32, FastNoise::OutputFormat::UInt16 } )
+        {
+            FastNoise::GridExportSettings settings;
+            settings.dimensions = dimensions;
+            settings.start[0] = -5; settings.start[1] = 12; settings.start[2] = 3;
+            settings.size[0] = 37; settings.size[1] = 21; settings.size[2] = 10;
+            settings.frequency = 0.05f;
+            settings.tileSize = 16;
+            settings.format.type = type;
+            settings.format.rangeMin = -0.7f;
+            settings.format.rangeMax = 0.7f;
+            settings.sourceHash = 42;
+            settings.threadCount = 2;
+            settings.resume = false;
+
+            int32_t zSize = dimensions == 3 ? settings.size[2] : 1;
+            std::vector<float> expected( (size_t)settings.size[0] * settings.size[1] * zSize );
+
+            if( dimensions == 3 )
+            {
+                generator->GenUniformGrid3D( expected.data(), settings.start[0], settings.start[1], settings.start[2], settings.size[0], settings.size[1], zSize, settings.frequency, settings.seed );
+            }
+            else
+            {
+                generator->GenUniformGrid2D( expected.data(), settings.start[0], settings.start[1], settings.size[0], settings.size[1], settings.frequency, settings.seed );
+            }
+
+            // Checks every tile against the plain grid, samples outside the grid must stay zero
+            auto checkFile = [&]( const std::vector<uint8_t>& file )
+            {
+                if( file.size() < sizeof( FastNoise::GridFileHeader ) )
+                {
+                    TEST_CHECK( file.size() >= sizeof( FastNoise::GridFileHeader ) );
+                    return;
+                }
+
+                FastNoise::GridFileHeader header;
+                memcpy( &header, file.data(), sizeof( header ) );
+                TEST_CHECK( header.magic == FastNoise::GridFileHeader::kMagic && header.seed == settings.seed );
+
+                size_t elementSize = settings.format.GetElementSize();
+                size_t tileCount = (size_t)header.tileCount[0] * header.tileCount[1] * header.tileCount[2];
+                TEST_CHECK( tileCount == ( dimensions == 3 ? 3 * 2 * 1 : 3 * 2 ) );
+
+                for( size_t index = 0; index < tileCount; index++ )
+                {
+                    FastNoise::GridFileTile tile;
+                    memcpy( &tile, file.data() + header.tileIndexOffset + index * sizeof( tile ), sizeof( tile ) );
+                    TEST_CHECK( tile.complete );
+
+                    int32_t tx = (int32_t)( index % header.tileCount[0] ) * header.tileSize;
+                    int32_t ty = (int32_t)( index / header.tileCount[0] % header.tileCount[1] ) * header.tileSize;
+                    int32_t tz = (int32_t)( index / header.tileCount[0] / header.tileCount[1] ) * header.tileSize;
+                    int32_t tileZSize = dimensions == 3 ? header.tileSize : 1;
+
+                    FastNoise::OutputMinMax minMax;
+                    std::vector<float> inside;
+                    std::vector<size_t> insideOffsets;
+                    bool outsideZero = true;
+
+                    for( int32_t z = 0; z < tileZSize; z++ )
+                    {
+                        for( int32_t y = 0; y < header.tileSize; y++ )
+                        {
+                            for( int32_t x = 0; x < header.tileSize; x++ )
+                            {
+                                size_t offset = header.tileDataOffset + index * header.tileBytes + ( ( (size_t)z * header.tileSize + y ) * header.tileSize + x ) * elementSize;
+
+                                if( tx + x < header.size[0] && ty + y < header.size[1] && tz + z < header.size[2] )
+                                {
+                                    float value = expected[( (size_t)( tz + z ) * header.size[1] + ty + y ) * header.size[0] + tx + x];
+                                    minMax << value;
+                                    inside.push_back( value );
+                                    insideOffsets.push_back( offset );
+                                }
+                                else
+                                {
+                                    for( size_t i = 0; i < elementSize; i++ )
+                                    {
+                                        outsideZero &= file[offset + i] == 0;
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    TEST_CHECK( outsideZero );
+                    TEST_CHECK( tile.min == minMax.min && tile.max == minMax.max );
+
+                    std::vector<uint8_t> formatted( inside.size() * elementSize );
+                    generator->QuantiseToFormat( formatted.data(), settings.format, inside.data(), inside.size() );
+
+                    bool match = true;
+                    for( size_t i = 0; i < inside.size(); i++ )
+                    {
+                        match &= memcmp( file.data() + insideOffsets[i], formatted.data() + i * elementSize, elementSize ) == 0;
+                    }
+                    TEST_CHECK( match );
+                }
+            };
+
+            FastNoise::GridExportResult result;
+            TEST_CHECK( FastNoise::ExportGrid( *generator, path, settings, &result ) );
+            TEST_CHECK( result.tilesGenerated == 6 && result.tilesSkipped == 0 );
+
+            std::vector<uint8_t> file = ReadFile( path );
+            checkFile( file );
+
+            // Simulate an interrupted export, tiles 1 and 4 were never marked complete and their first sample is stale
+            FastNoise::GridFileHeader header;
+            memcpy( &header, file.data(), sizeof( header ) );
+
+            for( size_t index : { 1, 4 } )
+            {
+                file[header.tileIndexOffset + index * sizeof( FastNoise::GridFileTile ) + offsetof( FastNoise::GridFileTile, complete )] = 0;
+                memset( file.data() + header.tileDataOffset + index * header.tileBytes, 0x5A, settings.format.GetElementSize() );
+            }
+            WriteFile( path, file );
+
+            settings.resume = true;
+            TEST_CHECK( FastNoise::ExportGrid( *generator, path, settings, &result ) );
+            TEST_CHECK( result.tilesGenerated == 2 && result.tilesSkipped == 4 );
+            checkFile( ReadFile( path ) );
+
+            // Different settings while resuming leave the file untouched
+            std::vector<uint8_t> before = ReadFile( path );
+            settings.seed++;
+            TEST_CHECK( !FastNoise::ExportGrid( *generator, path, settings, &result ) );
+            TEST_CHECK( ReadFile( path ) == before );
+        }
+    }
+
+    remove( path );
+}
+
+template<typename T>
+static void CheckFractalSingle( FastSIMD::eLevel level, void ( *configure )( T& ) = nullptr )
+{
+    // Octave counts below, at and above the widest vector, 40 takes the generic fallback
+    for( int32_t octaves : { 1, 3, 8, 16, 17, 40 } )
+    {
+        auto fractal = FastNoise::New<T>( level );
+        fractal->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+        fractal->SetOctaveCount( octaves );
+        fractal->SetLacunarity( 2.3f );
+        fractal->SetGain( 0.6f );
+
+        if( configure )
+        {
+            configure( *fractal );
+        }
+
+        const int32_t count = 37;
+        std::vector<float> xPos( count ), yPos( count ), zPos( count ), expected( count );
+
+        for( int32_t i = 0; i < count; i++ )
+        {
+            xPos[i] = i * 0.731f - 9.5f;
+            yPos[i] = i * -0.417f + 3.25f;
+            zPos[i] = i * 0.203f + 101.0f;
+        }
+
+        fractal->GenPositionArray2D( expected.data(), count, xPos.data(), yPos.data(), 0, 0, 1337 );
+
+        for( int32_t i = 0; i < count; i++ )
+        {
+            TEST_CHECK( fractal->GenSingle2D( xPos[i], yPos[i], 1337 ) == expected[i] );
+        }
+
+        fractal->GenPositionArray3D( expected.data(), count, xPos.data(), yPos.data(), zPos.data(), 0, 0, 0, 1337 );
+
+        for( int32_t i = 0; i < count; i++ )
+        {
+            TEST_CHECK( fractal->GenSingle3D( xPos[i], yPos[i], zPos[i], 1337 ) == expected[i] );
+        }
+    }
+}
+
+FASTNOISE_TEST( FractalSingleMatchesArray )
+{
+    CheckFractalSingle<FastNoise::FractalFBm>( level );
+    CheckFractalSingle<FastNoise::FractalBillow>( level );
+    CheckFractalSingle<FastNoise::FractalRidged>( level );
+    CheckFractalSingle<FastNoise::FractalRidgedMulti>( level );
+
+    // Gain driven by a node is sampled at the query position
+    CheckFractalSingle<FastNoise::FractalFBm>( level, []( FastNoise::FractalFBm& fractal )
+    {
+        fractal.SetGain( FastNoise::New<FastNoise::Perlin>( fractal.GetSIMDLevel() ) );
+    } );
+
+    CheckFractalSingle<FastNoise::FractalRidgedMulti>( level, []( FastNoise::FractalRidgedMulti& fractal )
+    {
+        fractal.SetWeightAmplitude( 0.8f );
+    } );
+}
+
+// Compares a 2D grid and a 3D position array of two generators, both include a partial final vector
+static bool OutputsMatch( const FastNoise::Generator& generator, const FastNoise::Generator& expected, float tolerance = 1e-5f )
+{
+    const int32_t count = 37 * 11;
+    std::vector<float> xPos( count ), yPos( count ), zPos( count ), result( count ), expectedResult( count );
+
+    for( int32_t i = 0; i < count; i++ )
+    {
+        xPos[i] = i * 0.37f - 4.0f;
+        yPos[i] = i * -0.11f;
+        zPos[i] = i * 0.05f + 9.0f;
+    }
+
+    generator.GenUniformGrid2D( result.data(), -3, 8, 37, 11, 0.07f, 1337 );
+    expected.GenUniformGrid2D( expectedResult.data(), -3, 8, 37, 11, 0.07f, 1337 );
+
+    for( int32_t i = 0; i < count; i++ )
+    {
+        if( !NearlyEqual( result[i], expectedResult[i], tolerance ) )
+        {
+            return false;
+        }
+    }
+
+    generator.GenPositionArray3D( result.data(), count, xPos.data(), yPos.data(), zPos.data(), 0.5f, 0, -1.0f, 1337 );
+    expected.GenPositionArray3D( expectedResult.data(), count, xPos.data(), yPos.data(), zPos.data(), 0.5f, 0, -1.0f, 1337 );
+
+    for( int32_t i = 0; i < count; i++ )
+    {
+        if( !NearlyEqual( result[i], expectedResult[i], tolerance ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+FASTNOISE_TEST( OperatorSourceLists )
+{
+    auto simplex = FastNoise::New<FastNoise::Simplex>( level );
+    auto perlin = FastNoise::New<FastNoise::Perlin>( level );
+
+    // Each list must match the same operator chained pairwise, generator and value entries mixed
+    auto addN = FastNoise::New<FastNoise::AddN>( level );
+    addN->SetSourceCount( 2 );
+    addN->SetSource( 0, simplex );
+    addN->SetSource( 1, perlin );
+    addN->AddSource( FastNoise::New<FastNoise::Simplex>( level ) );
+    addN->SetSourceCount( 4 );
+    addN->SetSource( 3, 0.5f );
+
+    auto add = FastNoise::New<FastNoise::Add>( level );
+    add->SetLHS( simplex );
+    add->SetRHS( perlin );
+    auto add2 = FastNoise::New<FastNoise::Add>( level );
+    add2->SetLHS( add );
+    add2->SetRHS( simplex );
+    auto add3 = FastNoise::New<FastNoise::Add>( level );
+    add3->SetLHS( add2 );
+    add3->SetRHS( 0.5f );
+
+    TEST_CHECK( OutputsMatch( *addN, *add3 ) );
+
+    auto multiplyN = FastNoise::New<FastNoise::MultiplyN>( level );
+    multiplyN->SetSourceCount( 3 );
+    multiplyN->SetSource( 0, simplex );
+    multiplyN->SetSource( 1, -1.5f );
+    multiplyN->SetSource( 2, perlin );
+
+    auto multiply = FastNoise::New<FastNoise::Multiply>( level );
+    multiply->SetLHS( simplex );
+    multiply->SetRHS( -1.5f );
+    auto multiply2 = FastNoise::New<FastNoise::Multiply>( level );
+    multiply2->SetLHS( multiply );
+    multiply2->SetRHS( perlin );
+
+    TEST_CHECK( OutputsMatch( *multiplyN, *multiply2 ) );
+
+    auto minN = FastNoise::New<FastNoise::MinN>( level );
+    auto maxN = FastNoise::New<FastNoise::MaxN>( level );
+    auto min = FastNoise::New<FastNoise::Min>( level );
+    auto max = FastNoise::New<FastNoise::Max>( level );
+    auto min2 = FastNoise::New<FastNoise::Min>( level );
+    auto max2 = FastNoise::New<FastNoise::Max>( level );
+
+    for( auto& list : { FastNoise::SmartNode<FastNoise::OperatorSourceList>( minN ), FastNoise::SmartNode<FastNoise::OperatorSourceList>( maxN ) } )
+    {
+        list->SetSourceCount( 3 );
+        list->SetSource( 0, simplex );
+        list->SetSource( 1, perlin );
+        list->SetSource( 2, 0.1f );
+    }
+
+    min->SetLHS( simplex );
+    min->SetRHS( perlin );
+    min2->SetLHS( min );
+    min2->SetRHS( 0.1f );
+    max->SetLHS( simplex );
+    max->SetRHS( perlin );
+    max2->SetLHS( max );
+    max2->SetRHS( 0.1f );
+
+    TEST_CHECK( OutputsMatch( *minN, *min2 ) );
+    TEST_CHECK( OutputsMatch( *maxN, *max2 ) );
+
+    // Hybrid lists survive encoding, both as a node tree and as node data
+    FastNoise::NodeData simplexData( simplex->GetMetadata() );
+    FastNoise::NodeData perlinData( perlin->GetMetadata() );
+    FastNoise::NodeData multiplyData( multiplyN->GetMetadata() );
+    multiplyData.hybridLists[0] = { { &simplexData, 0.0f }, { nullptr, -1.5f }, { &perlinData, 0.0f } };
+
+    std::string encoded = FastNoise::Metadata::SerialiseNodeData( &multiplyData, true );
+    auto decoded = FastNoise::NewFromEncodedNodeTree( encoded.c_str(), level );
+
+    TEST_CHECK( decoded && OutputsMatch( *decoded, *multiply2 ) );
+
+    std::vector<std::unique_ptr<FastNoise::NodeData>> nodeDatas;
+    FastNoise::NodeData* decodedData = FastNoise::Metadata::DeserialiseNodeData( encoded.c_str(), nodeDatas );
+
+    TEST_CHECK( decodedData && decodedData->hybridLists.size() == 1 && decodedData->hybridLists[0].size() == 3 );
+
+    if( decodedData && decodedData->hybridLists.size() == 1 && decodedData->hybridLists[0].size() == 3 )
+    {
+        const auto& list = decodedData->hybridLists[0];
+        TEST_CHECK( list[0].first && list[0].first->metadata == simplexData.metadata );
+        TEST_CHECK( !list[1].first && list[1].second == -1.5f );
+        TEST_CHECK( list[2].first && list[2].first->metadata == perlinData.metadata );
+    }
+
+    // MinN needs at least one source
+    multiplyData.metadata = minN->GetMetadata();
+    multiplyData.hybridLists[0].clear();
+    TEST_CHECK( !FastNoise::NewFromEncodedNodeTree( FastNoise::Metadata::SerialiseNodeData( &multiplyData ).c_str(), level ) );
+}
+
+FASTNOISE_TEST( CurveTables )
+{
+    // Source is the grid x position, so each sample is the curve evaluated at a known input
+    auto position = FastNoise::New<FastNoise::PositionOutput>( level );
+    position->Set<FastNoise::Dim::X>( 1.0f );
+
+    auto curve = FastNoise::New<FastNoise::Curve>( level );
+    curve->SetSource( position );
+    TEST_CHECK( curve->SetPoints( "-1 0, 0 1, 1 0.5" ) );
+
+    const int32_t size = 67;
+    std::vector<float> input( size ), result( size );
+
+    position->GenUniformGrid2D( input.data(), -33, 0, size, 1, 1.0f / 24, 1337 );
+    curve->GenUniformGrid2D( result.data(), -33, 0, size, 1, 1.0f / 24, 1337 );
+
+    // Linear is exact between points and clamps outside them
+    for( int32_t i = 0; i < size; i++ )
+    {
+        float x = input[i];
+        float expected = x <= -1 ? 0 : x <= 0 ? x + 1 : x <= 1 ? 1 - x * 0.5f : 0.5f;
+
+        TEST_CHECK( NearlyEqual( result[i], expected, 1e-4f ) );
+    }
+
+    // Cubic passes through the points and does not overshoot them
+    curve->SetInterpolation( FastNoise::Curve::Interpolation::Cubic );
+    curve->GenUniformGrid2D( result.data(), -33, 0, size, 1, 1.0f / 24, 1337 );
+
+    for( int32_t i = 0; i < size; i++ )
+    {
+        TEST_CHECK( result[i] >= -1e-5f && result[i] <= 1.0f + 1e-5f );
+
+        if( input[i] == -1.0f || input[i] == 0.0f || input[i] == 1.0f )
+        {
+            TEST_CHECK( NearlyEqual( result[i], input[i] == -1.0f ? 0.0f : input[i] == 0.0f ? 1.0f : 0.5f, 1e-4f ) );
+        }
+    }
+
+    TEST_CHECK( input[9] == -1.0f && input[33] == 0.0f && input[57] == 1.0f );
+
+    for( const char* invalid : { "", "1", "1 2 3", "a b" } )
+    {
+        TEST_CHECK( !curve->SetPoints( invalid ) );
+    }
+}
+
+FASTNOISE_TEST( BakedWrap )
+{
+    auto source = FastNoise::New<FastNoise::FractalFBm>( level );
+    source->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+
+    auto baked = FastNoise::New<FastNoise::Baked>( level );
+    baked->SetSource( source );
+    baked->SetResolution( 32 );
+    baked->SetPeriod( 8.0f );
+
+    // Frequency 0.25 puts one period every 32 samples, grids a whole number of periods apart are identical
+    const int32_t period = 32;
+    std::vector<float> grid( period * period * 4 ), shifted( grid.size() );
+
+    baked->GenUniformGrid2D( grid.data(), 0, 0, period * 2, period * 2, 0.25f, 7 );
+    baked->GenUniformGrid2D( shifted.data(), -period * 3, period * 5, period * 2, period * 2, 0.25f, 7 );
+
+    for( size_t i = 0; i < grid.size(); i++ )
+    {
+        TEST_CHECK( NearlyEqual( grid[i], shifted[i], 1e-4f ) );
+    }
+
+    baked->GenUniformGrid3D( grid.data(), 0, 0, 0, period, period, 4, 0.25f, 7 );
+    baked->GenUniformGrid3D( shifted.data(), period, -period * 2, period * 5, period, period, 4, 0.25f, 7 );
+
+    for( size_t i = 0; i < (size_t)period * period * 4; i++ )
+    {
+        TEST_CHECK( NearlyEqual( grid[i], shifted[i], 1e-4f ) );
+    }
+
+    // No seam: the step across a period boundary is no larger than the largest step elsewhere on the line
+    for( int32_t dimensions : { 2, 3 } )
+    {
+        std::vector<float> line( period * 4 );
+
+        if( dimensions == 2 )
+        {
+            baked->GenUniformGrid2D( line.data(), -period * 2, 3, period * 4, 1, 0.25f, 7 );
+        }
+        else
+        {
+            baked->GenUniformGrid3D( line.data(), -period * 2, 3, 5, period * 4, 1, 1, 0.25f, 7 );
+        }
+
+        float maxStep = 0;
+        for( int32_t i = 1; i < period * 4; i++ )
+        {
+            if( i % period != 0 )
+            {
+                maxStep = std::max( maxStep, std::fabs( line[i] - line[i - 1] ) );
+            }
+        }
+
+        for( int32_t i = period; i < period * 4; i += period )
+        {
+            TEST_CHECK( std::fabs( line[i] - line[i - 1] ) <= maxStep * 1.5f );
+        }
+    }
+
+    // Budget for two 16^2 grids: the first two seeds are baked, the third samples the source directly
+    baked->SetResolution( 16 );
+    baked->SetMemoryBudgetMB( 2.5f * 16 * 16 * sizeof( float ) / ( 1024.0f * 1024.0f ) );
+
+    std::vector<float> expected( 37 * 11 ), result( 37 * 11 );
+
+    for( int32_t seed : { 1, 2, 3 } )
+    {
+        baked->GenUniformGrid2D( result.data(), 5, -2, 37, 11, 0.3f, seed );
+        source->GenUniformGrid2D( expected.data(), 5, -2, 37, 11, 0.3f, seed );
+
+        TEST_CHECK( ( result == expected ) == ( seed == 3 ) );
+    }
+
+    // A budget below one kMinResolution grid never bakes
+    baked->SetMemoryBudgetMB( 0.0f );
+    baked->GenUniformGrid2D( result.data(), 5, -2, 37, 11, 0.3f, 1 );
+    source->GenUniformGrid2D( expected.data(), 5, -2, 37, 11, 0.3f, 1 );
+
+    TEST_CHECK( result == expected );
+}
+
+FASTNOISE_TEST( PerSampleSeeds )
+{
+    auto generator = FastNoise::New<FastNoise::FractalRidged>( level );
+    generator->SetSource( FastNoise::New<FastNoise::CellularValue>( level ) );
+
+    const int32_t count = 101;
+    const int32_t seedValues[3] = { 1337, -300, 7919 };
+
+    std::vector<float> xPos( count ), yPos( count ), zPos( count ), result( count ), expected[3];
+    std::vector<int32_t> seeds( count );
+
+    for( int32_t i = 0; i < count; i++ )
+    {
+        xPos[i] = i * 0.37f;
+        yPos[i] = i * -0.11f;
+        zPos[i] = i * 0.05f;
+        seeds[i] = seedValues[i * 7 % 3];
+    }
+
+    for( int32_t dimensions : { 2, 3 } )
+    {
+        // Every sample must match the same position generated with its seed for the whole array
+        for( int32_t s = 0; s < 3; s++ )
+        {
+            expected[s].resize( count );
+
+            if( dimensions == 2 )
+            {
+                generator->GenPositionArray2D( expected[s].data(), count, xPos.data(), yPos.data(), 1, 2, seedValues[s] );
+            }
+            else
+            {
+                generator->GenPositionArray3D( expected[s].data(), count, xPos.data(), yPos.data(), zPos.data(), 1, 2, 3, seedValues[s] );
+            }
+        }
+
+        if( dimensions == 2 )
+        {
+            generator->GenPositionArray2D( result.data(), count, xPos.data(), yPos.data(), 1, 2, seeds.data() );
+        }
+        else
+        {
+            generator->GenPositionArray3D( result.data(), count, xPos.data(), yPos.data(), zPos.data(), 1, 2, 3, seeds.data() );
+        }
+
+        for( int32_t i = 0; i < count; i++ )
+        {
+            TEST_CHECK( result[i] == expected[i * 7 % 3][i] );
+        }
+    }
+}
+
+FASTNOISE_TEST( InterleavedPositions )
+{
+    struct Vertex
+    {
+        float normal;
+        float x, y, z;
+        float u;
+    };
+
+    auto generator = FastNoise::New<FastNoise::OpenSimplex2>( level );
+
+    for( int32_t count : { 1, 3, 17, 100 } )
+    {
+        std::vector<Vertex> vertices( count );
+        std::vector<float> xPos( count ), yPos( count ), zPos( count ), expected( count ), result( count );
+
+        for( int32_t i = 0; i < count; i++ )
+        {
+            vertices[i] = { 9.0f, i * 0.31f, i * -0.17f + 2, i * 0.05f, 7.0f };
+            xPos[i] = vertices[i].x;
+            yPos[i] = vertices[i].y;
+            zPos[i] = vertices[i].z;
+        }
+
+        generator->GenPositionArray3D( expected.data(), count, xPos.data(), yPos.data(), zPos.data(), 1, 2, 3, 5 );
+        generator->GenPositionArray3D( result.data(), count, &vertices[0].x, sizeof( Vertex ), 1, 2, 3, 5 );
+        TEST_CHECK( result == expected );
+
+        generator->GenPositionArray2D( expected.data(), count, yPos.data(), zPos.data(), 1, 2, 5 );
+        generator->GenPositionArray2D( result.data(), count, &vertices[0].y, sizeof( Vertex ), 1, 2, 5 );
+        TEST_CHECK( result == expected );
+    }
+}
+
+FASTNOISE_TEST( OccupancyAndBands )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+    const float thresholds[3] = { -0.2f, 0.0f, 0.15f };
+
+    // Row lengths around the 32 bit word size
+    for( int32_t xSize : { 16, 17, 32, 33 } )
+    {
+        const int32_t ySize = 3, zSize = 5;
+
+        for( int32_t dimensions : { 2, 3 } )
+        {
+            size_t count = (size_t)xSize * ySize * ( dimensions == 3 ? zSize : 1 );
+            size_t words = ( count + 31 ) / 32;
+
+            std::vector<float> expected( count );
+            std::vector<uint32_t> occupancy( words + 1, 0xDEADBEEF );
+            std::vector<uint8_t> bands( count + 1, 0xAB );
+
+            if( dimensions == 3 )
+            {
+                generator->GenUniformGrid3D( expected.data(), 1, 2, 3, xSize, ySize, zSize, 0.1f, 5 );
+                generator->GenUniformGrid3D( occupancy.data(), 0.05f, 1, 2, 3, xSize, ySize, zSize, 0.1f, 5 );
+                generator->GenUniformGrid3D( bands.data(), thresholds, 3, 1, 2, 3, xSize, ySize, zSize, 0.1f, 5 );
+            }
+            else
+            {
+                generator->GenUniformGrid2D( expected.data(), 1, 2, xSize, ySize, 0.1f, 5 );
+                generator->GenUniformGrid2D( occupancy.data(), 0.05f, 1, 2, xSize, ySize, 0.1f, 5 );
+                generator->GenUniformGrid2D( bands.data(), thresholds, 3, 1, 2, xSize, ySize, 0.1f, 5 );
+            }
+
+            // Bits past the last sample are clear and nothing is written past the outputs
+            for( size_t i = 0; i < words * 32; i++ )
+            {
+                bool bit = ( occupancy[i / 32] >> ( i % 32 ) ) & 1;
+                TEST_CHECK( bit == ( i < count && expected[i] > 0.05f ) );
+            }
+
+            for( size_t i = 0; i < count; i++ )
+            {
+                int band = ( expected[i] >= thresholds[0] ) + ( expected[i] >= thresholds[1] ) + ( expected[i] >= thresholds[2] );
+                TEST_CHECK( bands[i] == band );
+            }
+
+            TEST_CHECK( occupancy[words] == 0xDEADBEEF );
+            TEST_CHECK( bands[count] == 0xAB );
+        }
+    }
+}
+
+FASTNOISE_TEST( SparseVolumeBricks )
+{
+    // Density falls with y, so bricks far below and above the surface are uniform
+    auto gradient = FastNoise::New<FastNoise::PositionOutput>( level );
+    gradient->Set<FastNoise::Dim::Y>( -1.0f );
+
+    auto density = FastNoise::New<FastNoise::Add>( level );
+    density->SetLHS( FastNoise::New<FastNoise::Perlin>( level ) );
+    density->SetRHS( gradient );
+
+    const int32_t xSize = 32, ySize = 64, zSize = 24;
+    std::vector<float> expected( (size_t)xSize * ySize * zSize );
+
+    density->GenUniformGrid3D( expected.data(), 0, -32, 0, xSize, ySize, zSize, 0.1f, 4 );
+
+    for( int32_t brickSize : { 4, 8 } )
+    {
+        for( float tolerance : { 0.0f, 0.3f } )
+        {
+            FastNoise::SparseVolume volume;
+            density->GenUniformGrid3D( volume, brickSize, 0.0f, tolerance, 0, -32, 0, xSize, ySize, zSize, 0.1f, 4 );
+
+            size_t uniformCount = 0;
+
+            for( int32_t bz = 0; bz < zSize / brickSize; bz++ )
+            {
+                for( int32_t by = 0; by < ySize / brickSize; by++ )
+                {
+                    for( int32_t bx = 0; bx < xSize / brickSize; bx++ )
+                    {
+                        size_t brick = volume.GetBrickIndex( bx, by, bz );
+                        FastNoise::OutputMinMax brickMinMax;
+                        std::vector<float> brickValues;
+
+                        // Dense bricks hold their samples in xyz order
+                        for( int32_t z = 0; z < brickSize; z++ )
+                        {
+                            for( int32_t y = 0; y < brickSize; y++ )
+                            {
+                                for( int32_t x = 0; x < brickSize; x++ )
+                                {
+                                    float value = expected[( (size_t)( bz * brickSize + z ) * ySize + by * brickSize + y ) * xSize + bx * brickSize + x];
+                                    brickMinMax << value;
+                                    brickValues.push_back( value );
+                                }
+                            }
+                        }
+
+                        bool uniform = brickMinMax.max - brickMinMax.min <= tolerance || brickMinMax.min > 0.0f || brickMinMax.max <= 0.0f;
+                        TEST_CHECK( volume.IsBrickUniform( brick ) == uniform );
+
+                        if( uniform )
+                        {
+                            uniformCount++;
+                            TEST_CHECK( volume.GetBrickConstant( brick ) == ( brickMinMax.min + brickMinMax.max ) * 0.5f );
+                            TEST_CHECK( !volume.GetBrickValues( brick ) );
+                        }
+                        else
+                        {
+                            const float* values = volume.GetBrickValues( brick );
+                            TEST_CHECK( values && std::equal( brickValues.begin(), brickValues.end(), values ) );
+                        }
+                    }
+                }
+            }
+
+            TEST_CHECK( uniformCount > 0 && uniformCount < volume.GetBrickCount() );
+            TEST_CHECK( volume.GetDenseBrickCount() == volume.GetBrickCount() - uniformCount );
+        }
+    }
+}
+
+FASTNOISE_TEST( BrickMinMax )
+{
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+
+    // Brick sizes that do and do not divide the grid, edge bricks are clipped
+    for( int32_t brickSize : { 3, 4, 8 } )
+    {
+        for( int32_t dimensions : { 2, 3 } )
+        {
+            const int32_t xSize = 37, ySize = 21, zSize = dimensions == 3 ? 19 : 1;
+            int32_t xBricks = ( xSize + brickSize - 1 ) / brickSize;
+            int32_t yBricks = ( ySize + brickSize - 1 ) / brickSize;
+            int32_t zBricks = ( zSize + brickSize - 1 ) / brickSize;
+
+            std::vector<float> expected( (size_t)xSize * ySize * zSize ), result( expected.size() );
+            std::vector<FastNoise::OutputMinMax> bricks( (size_t)xBricks * yBricks * zBricks ), expectedBricks( bricks.size() );
+            FastNoise::OutputMinMax minMax;
+
+            if( dimensions == 3 )
+            {
+                generator->GenUniformGrid3D( expected.data(), 5, -3, 2, xSize, ySize, zSize, 0.05f, 7 );
+                minMax = generator->GenUniformGrid3DBrickMinMax( result.data(), bricks.data(), brickSize, 5, -3, 2, xSize, ySize, zSize, 0.05f, 7 );
+            }
+            else
+            {
+                generator->GenUniformGrid2D( expected.data(), 5, -3, xSize, ySize, 0.05f, 7 );
+                minMax = generator->GenUniformGrid2DBrickMinMax( result.data(), bricks.data(), brickSize, 5, -3, xSize, ySize, 0.05f, 7 );
+            }
+
+            TEST_CHECK( result == expected );
+
+            FastNoise::OutputMinMax expectedMinMax;
+
+            for( size_t i = 0; i < expected.size(); i++ )
+            {
+                size_t x = i % xSize, y = i / xSize % ySize, z = i / xSize / ySize;
+                expectedBricks[( z / brickSize * yBricks + y / brickSize ) * xBricks + x / brickSize] << expected[i];
+                expectedMinMax << expected[i];
+            }
+
+            for( size_t i = 0; i < bricks.size(); i++ )
+            {
+                TEST_CHECK( bricks[i].min == expectedBricks[i].min && bricks[i].max == expectedBricks[i].max );
+            }
+
+            TEST_CHECK( minMax.min == expectedMinMax.min && minMax.max == expectedMinMax.max );
+        }
+    }
+}
+
+FASTNOISE_TEST( OutputStatistics )
+{
+    auto generator = FastNoise::New<FastNoise::FractalFBm>( level );
+    generator->SetSource( FastNoise::New<FastNoise::Simplex>( level ) );
+
+    const int32_t xSize = 67, ySize = 45, zSize = 9;
+    size_t count = (size_t)xSize * ySize * zSize;
+
+    std::vector<float> expected( count ), result( count );
+    generator->GenUniformGrid3D( expected.data(), 3, 1, -2, xSize, ySize, zSize, 0.03f, 9 );
+
+    FastNoise::OutputStats stats;
+    stats.flags = FastNoise::OutputStats::All;
+    stats.threshold = 0.1f;
+    stats.histogramMin = -0.8f;
+    stats.histogramMax = 0.8f;
+
+    FastNoise::OutputStats statsOnly = stats;
+
+    generator->GenUniformGrid3D( result.data(), stats, 3, 1, -2, xSize, ySize, zSize, 0.03f, 9 );
+    generator->GenUniformGrid3D( nullptr, statsOnly, 3, 1, -2, xSize, ySize, zSize, 0.03f, 9 );
+
+    TEST_CHECK( result == expected );
+
+    double sum = 0, sumSq = 0;
+    uint64_t aboveThreshold = 0;
+    uint64_t histogram[FastNoise::OutputStats::kHistogramBins] = {};
+    FastNoise::OutputMinMax minMax;
+
+    for( float value : expected )
+    {
+        sum += value;
+        minMax << value;
+        aboveThreshold += value > stats.threshold;
+
+        float bin = ( value - stats.histogramMin ) * ( FastNoise::OutputStats::kHistogramBins / ( stats.histogramMax - stats.histogramMin ) );
+        histogram[(int)std::min<float>( std::max( bin, 0.0f ), FastNoise::OutputStats::kHistogramBins - 1 )]++;
+    }
+
+    double mean = sum / count;
+
+    for( float value : expected )
+    {
+        sumSq += ( value - mean ) * ( value - mean );
+    }
+
+    TEST_CHECK( stats.count == count );
+    TEST_CHECK( stats.minMax.min == minMax.min && stats.minMax.max == minMax.max );
+    TEST_CHECK( stats.aboveThresholdCount == aboveThreshold );
+    TEST_CHECK( std::fabs( stats.mean - mean ) <= 1e-5 );
+    TEST_CHECK( std::fabs( stats.variance - sumSq / count ) <= 1e-5 * sumSq / count );
+
+    // Bin edges may round differently in vectors, allow a few samples to move to a neighbouring bin
+    uint64_t histogramTotal = 0, histogramDiff = 0;
+
+    for( int32_t i = 0; i < FastNoise::OutputStats::kHistogramBins; i++ )
+    {
+        histogramTotal += stats.histogram[i];
+        histogramDiff += std::max( histogram[i], stats.histogram[i] ) - std::min( histogram[i], stats.histogram[i] );
+    }
+
+    TEST_CHECK( histogramTotal == count && histogramDiff <= 4 );
+
+    // Statistics do not depend on storing the values
+    TEST_CHECK( memcmp( statsOnly.histogram, stats.histogram, sizeof( stats.histogram ) ) == 0 );
+    TEST_CHECK( statsOnly.mean == stats.mean && statsOnly.variance == stats.variance && statsOnly.aboveThresholdCount == stats.aboveThresholdCount );
+
+    // Unrequested statistics are left untouched
+    FastNoise::OutputStats minMaxOnly;
+    generator->GenUniformGrid3D( nullptr, minMaxOnly, 3, 1, -2, xSize, ySize, zSize, 0.03f, 9 );
+
+    TEST_CHECK( minMaxOnly.minMax.min == minMax.min && minMaxOnly.minMax.max == minMax.max );
+    TEST_CHECK( minMaxOnly.mean == 0 && minMaxOnly.aboveThresholdCount == 0 && minMaxOnly.histogram[0] == 0 );
+}
+
+static size_t MortonIndex( int32_t x, int32_t y, int32_t z )
+{
+    size_t index = 0;
+
+    for( int32_t bit = 0; bit < 10; bit++ )
+    {
+        index |= (size_t)( ( x >> bit ) & 1 ) << ( bit * 3 );
+        index |= (size_t)( ( y >> bit ) & 1 ) << ( bit * 3 + 1 );
+        index |= (size_t)( ( z >> bit ) & 1 ) << ( bit * 3 + 2 );
+    }
+    return index;
+}
+
+FASTNOISE_TEST( GridLayouts )
+{
+    using Layout = FastNoise::GridLayout3D;
+
+    struct Case
+    {
+        int32_t xSize, ySize, zSize;
+        Layout layout;
+    };
+
+    auto generator = FastNoise::New<FastNoise::Perlin>( level );
+
+    for( Case test : { Case{ 16, 8, 24, Layout::Bricked8 }, Case{ 12, 4, 8, Layout::Bricked4 }, Case{ 4, 4, 4, Layout::Morton }, Case{ 16, 16, 16, Layout::Morton } } )
+    {
+        size_t count = (size_t)test.xSize * test.ySize * test.zSize;
+        std::vector<float> expected( count ), result( count + 1, -99.0f );
+
+        generator->GenUniformGrid3D( expected.data(), -5, 3, 100, test.xSize, test.ySize, test.zSize, 0.05f, 11 );
+        generator->GenUniformGrid3D( result.data(), test.layout, -5, 3, 100, test.xSize, test.ySize, test.zSize, 0.05f, 11 );
+
+        int32_t brickSize = test.layout == Layout::Bricked4 ? 4 : 8;
+        bool match = true;
+
+        for( size_t i = 0; i < count; i++ )
+        {
+            int32_t x = (int32_t)( i % test.xSize ), y = (int32_t)( i / test.xSize % test.ySize ), z = (int32_t)( i / test.xSize / test.ySize );
+            size_t index;
+
+            if( test.layout == Layout::Morton )
+            {
+                index = MortonIndex( x, y, z );
+            }
+            else
+            {
+                size_t brick = ( (size_t)z / brickSize * ( test.ySize / brickSize ) + y / brickSize ) * ( test.xSize / brickSize ) + x / brickSize;
+                index = brick * brickSize * brickSize * brickSize + ( (size_t)( z % brickSize ) * brickSize + y % brickSize ) * brickSize + x % brickSize;
+            }
+
+            match &= result[index] == expected[i];
+        }
+
+        TEST_CHECK( match );
+        TEST_CHECK( result[count] == -99.0f );
+    }
+}
+
+int main( int argc, char** argv )
+{
+    return FastNoiseUnitTest::RunAll() == 0 ? 0 : 1;
+}
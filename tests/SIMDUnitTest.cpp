@@ -173,6 +173,30 @@ SIMD_FUNCTION_TEST( LoadStore_f32, float, FS_Store_f32( &result, FS_Load_f32( &r
 
 SIMD_FUNCTION_TEST( LoadStore_i32, int32_t, FS_Store_i32( &result, FS_Load_i32( &rndInts0[i] ) ) )
 
+SIMD_FUNCTION_TEST( Gather_f32, float, FS_Store_f32( &result, FS_Gather_f32( rndFloats0, FS_Load_i32( &rndInts0[i] ) & typename FS::int32v( TestCount - 1 ) ) ) )
+
+SIMD_FUNCTION_TEST( LoadTransposed2_f32, float, { typename FS::float32v x; typename FS::float32v y; FS_LoadTransposed2_f32( &rndFloats0[( i & ( TestCount / 2 - 1 ) ) * 2], 8, x, y ); FS_Store_f32( &result, x - y ); } )
+
+SIMD_FUNCTION_TEST( MaskedLoad_f32, float, FS_Store_f32( &result, FS_MaskedLoad_f32( &rndFloats0[i], FS_GreaterThan_i32( FS_Load_i32( &rndInts0[i] ), FS_Load_i32( &rndInts1[i] ) ) ) ) )
+
+SIMD_FUNCTION_TEST( MaskedLoad_i32, int32_t, FS_Store_i32( &result, FS_MaskedLoad_i32( &rndInts0[i], FS_GreaterThan_f32( FS_Load_f32( &rndFloats0[i] ), FS_Load_f32( &rndFloats1[i] ) ) ) ) )
+
+SIMD_FUNCTION_TEST( MaskedStore_f32, float, FS_Store_f32( &result, typename FS::float32v( 0 ) ); FS_MaskedStore_f32( &result, FS_Load_f32( &rndFloats0[i] ), FS_LessThan_i32( FS_Load_i32( &rndInts0[i] ), FS_Load_i32( &rndInts1[i] ) ) ) )
+
+SIMD_FUNCTION_TEST( StoreNonTemporal_f32, float, { alignas( 64 ) float aligned[FS_Size_32()]; FS_StoreNonTemporal_f32( aligned, FS_Load_f32( &rndFloats0[i] ) ); FS_StoreFence(); FS_Store_f32( &result, FS_Load_f32( aligned ) ); } )
+
+SIMD_FUNCTION_TEST( LoadTransposed3_f32, float, { typename FS::float32v x; typename FS::float32v y; typename FS::float32v z; FS_LoadTransposed3_f32( &rndFloats0[( i & ( TestCount / 4 - 1 ) ) * 3], 12, x, y, z ); FS_Store_f32( &result, ( x - y ) * z ); } )
+
+SIMD_FUNCTION_TEST( MoveMask_m32, int32_t, { uint32_t bits = FS_MoveMask_m32( FS_GreaterThan_i32( FS_Load_i32( &rndInts0[i] ), FS_Load_i32( &rndInts1[i] ) ) ); for( std::size_t j = 0; j < FS_Size_32(); j++ ) result[j] = ( bits >> j ) & 1; } )
+
+SIMD_FUNCTION_TEST( StorePacked_u8, uint8_t, FS_StorePacked_u8( &result, FS_Load_i32( &rndInts0[i] ) >> 22 ) )
+
+SIMD_FUNCTION_TEST( StorePacked_u16, uint16_t, FS_StorePacked_u16( &result, FS_Load_i32( &rndInts0[i] ) >> 14 ) )
+
+SIMD_FUNCTION_TEST( StorePacked_i16, int16_t, FS_StorePacked_i16( &result, FS_Load_i32( &rndInts0[i] ) >> 14 ) )
+
+SIMD_FUNCTION_TEST( StorePacked_f16, uint16_t, FS_StorePacked_f16( &result, FS_Load_f32( &rndFloats0[i] ) * typename FS::float32v( 1.0e-36f ) ) )
+
 
 SIMD_FUNCTION_TEST( Casti32_f32, float, FS_Store_f32( &result, FS_Casti32_f32( FS_Load_i32( &rndInts0[i] ) ) ) )
 